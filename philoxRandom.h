@@ -0,0 +1,55 @@
+#ifndef PHILOX_RANDOM_H
+#define PHILOX_RANDOM_H
+
+#include <cstdint>
+
+// Philox4x32-10, a counter-based random number generator (Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3"). The output is a pure function of a 128-bit counter and a
+// 64-bit key, so there is no state to share or lock: any thread or process that asks for the
+// same counter and key gets the same four words, in any order.
+const uint32_t PHILOX_MULTIPLIER_0 = 0xD2511F53u;
+const uint32_t PHILOX_MULTIPLIER_1 = 0xCD9E8D57u;
+const uint32_t PHILOX_KEY_BUMP_0 = 0x9E3779B9u; // golden ratio
+const uint32_t PHILOX_KEY_BUMP_1 = 0xBB67AE85u; // sqrt(3) - 1
+const int PHILOX_ROUNDS = 10;
+
+// Helper function: one Philox round on the counter
+inline void philoxRound(uint32_t counter[4], const uint32_t key[2])
+{
+    const uint64_t product0 = uint64_t(PHILOX_MULTIPLIER_0) * counter[0];
+    const uint64_t product1 = uint64_t(PHILOX_MULTIPLIER_1) * counter[2];
+    const uint32_t next0 = uint32_t(product1 >> 32) ^ counter[1] ^ key[0];
+    const uint32_t next1 = uint32_t(product1);
+    const uint32_t next2 = uint32_t(product0 >> 32) ^ counter[3] ^ key[1];
+    const uint32_t next3 = uint32_t(product0);
+    counter[0] = next0;
+    counter[1] = next1;
+    counter[2] = next2;
+    counter[3] = next3;
+}
+
+// Turn a counter and a key into four random words
+inline void philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t result[4])
+{
+    uint32_t roundKey[2] = {key[0], key[1]};
+    int i;
+    for (i = 0; i < 4; i++)
+        result[i] = counter[i];
+    for (i = 0; i < PHILOX_ROUNDS; i++)
+    {
+        if (i > 0)
+        {
+            roundKey[0] += PHILOX_KEY_BUMP_0;
+            roundKey[1] += PHILOX_KEY_BUMP_1;
+        }
+        philoxRound(result, roundKey);
+    }
+}
+
+// Helper function: map a random word to [0, range) without a division
+inline uint32_t philoxBelow(const uint32_t word, const uint32_t range)
+{
+    return uint32_t((uint64_t(word) * range) >> 32);
+}
+
+#endif
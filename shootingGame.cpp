@@ -0,0 +1,1569 @@
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "shootingGame.h"
+#include "philoxRandom.h"
+using namespace std;
+
+// Helper function: mapping the robotLetter to the correct array index
+// e.g., 'A'=>0, 'B'=>1, ...
+int robotLetterToArrayIndex(const char robotLetter)
+{
+    return int(robotLetter - 'A');
+}
+
+// Helper function: mapping array index to the robot letter
+// e.g., 0=>'A', 1=>'B', ...
+char arrayIndexToRobotLetter(const int index)
+{
+    return char(index + 'A');
+}
+
+// Helper function: convert a direction letter to its index in the wall distances
+// Returns -1 for an unknown direction
+int directionLetterToIndex(const char directionLetter)
+{
+    if (directionLetter == DIRECTION_EAST)
+        return DIRECTION_INDEX_EAST;
+    else if (directionLetter == DIRECTION_SOUTH)
+        return DIRECTION_INDEX_SOUTH;
+    else if (directionLetter == DIRECTION_WEST)
+        return DIRECTION_INDEX_WEST;
+    else if (directionLetter == DIRECTION_NORTH)
+        return DIRECTION_INDEX_NORTH;
+    return -1;
+}
+
+// Helper function: Initialize the 2D array with an empty character
+void initializeMap(char map[MAX_ROWS][MAX_COLS], const int numRows, const int numCols)
+{
+    int r, c;
+    for (r = 0; r < numRows; r++)
+        for (c = 0; c < numCols; c++)
+            map[r][c] = CHAR_EMPTY;
+}
+
+// Helper function: whether a cell can be on a loaded map: empty, a wall or a robot letter
+// Every other cell would be taken for a robot and index the health points out of range
+bool isMapCellValid(const char cell)
+{
+    return cell == CHAR_EMPTY || cell == CHAR_WALL || (cell >= 'A' && cell <= 'Z');
+}
+
+// Helper function: Initialize the 1D array with zeros
+void initializeHealthPoints(int healthPoints[MAX_NUM_ROBOTS])
+{
+    int i;
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+        healthPoints[i] = 0;
+}
+
+int updateHealthPointsForHitAction(int healthPoints[MAX_NUM_ROBOTS],
+                                   char map[MAX_ROWS][MAX_COLS],
+                                   const int mapRows, const int mapCols,
+                                   const int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS],
+                                   const char robotLetter,
+                                   const char directionLetter,
+                                   char &targetRobotLetter,
+                                   int &targetOriginalHealthPoint,
+                                   int &targetUpdatedHealthPoint,
+                                   const int damage)
+{
+
+    int xloc = 0;
+    int yloc = 0;
+    int stop = 0;
+    for(int i = 0; i < mapRows; i++)
+    {
+        for(int j = 0; j < mapCols; j++)
+        {
+            if(map[i][j] == robotLetter && stop == 0)
+            {
+                xloc = i;
+                yloc = j;
+                stop += 1;
+            }
+        }
+    }
+
+    // walls cannot be damaged
+    const int direction = directionLetterToIndex(directionLetter);
+    if(direction >= 0 && wallDistances[xloc][yloc][direction] == 1)
+    {
+        return STATUS_ACTION_WEAPON_FAIL;
+    }
+
+    if(directionLetter == DIRECTION_SOUTH){
+        if(xloc+1 < mapRows)
+        {
+            if(map[xloc+1][yloc] != CHAR_EMPTY)
+            {
+                targetRobotLetter = map[xloc+1][yloc];
+                targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+1][yloc])];
+                targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+1][yloc])] - damage;
+                healthPoints[robotLetterToArrayIndex(map[xloc+1][yloc])] -= damage;
+                if(targetUpdatedHealthPoint <= 0)
+                {
+                    targetUpdatedHealthPoint = 0;
+                    healthPoints[robotLetterToArrayIndex(map[xloc+1][yloc])] -= damage;
+                    map[xloc+1][yloc]='.';
+                }
+
+                return STATUS_ACTION_WEAPON_SUCCESS;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_NORTH){
+        if(xloc-1 >= 0)
+        {
+            if(map[xloc-1][yloc] != CHAR_EMPTY)
+            {
+                targetRobotLetter = map[xloc-1][yloc];
+                targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc-1][yloc])];
+                targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc-1][yloc])] - damage;
+                healthPoints[robotLetterToArrayIndex(map[xloc-1][yloc])] -= damage;
+                if(targetUpdatedHealthPoint <= 0)
+                {
+                    targetUpdatedHealthPoint = 0;
+                    healthPoints[robotLetterToArrayIndex(map[xloc-1][yloc])] = 0;
+                    map[xloc-1][yloc]='.';
+                }
+                return STATUS_ACTION_WEAPON_SUCCESS;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_EAST){
+        if(yloc+1 < mapCols)
+        {
+            if(map[xloc][yloc+1] != CHAR_EMPTY)
+            {
+                targetRobotLetter = map[xloc][yloc+1];
+                targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+1])];
+                targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+1])] - damage;
+                healthPoints[robotLetterToArrayIndex(map[xloc][yloc+1])] -= damage;
+                if(targetUpdatedHealthPoint <= 0)
+                {
+                    targetUpdatedHealthPoint = 0;
+                    healthPoints[robotLetterToArrayIndex(map[xloc][yloc+1])] = 0; 
+                    map[xloc][yloc+1]='.'; 
+                }
+                return STATUS_ACTION_WEAPON_SUCCESS;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_WEST){
+        if(yloc-1 <= 0)
+        {
+            if(map[xloc][yloc-1] != CHAR_EMPTY)
+            {
+                targetRobotLetter = map[xloc][yloc-1];
+                targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc-1])];
+                targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc-1])] - damage;
+                healthPoints[robotLetterToArrayIndex(map[xloc][yloc-1])] -= damage;
+                
+                if(targetUpdatedHealthPoint <= 0)
+                {
+                    targetUpdatedHealthPoint = 0;
+                    healthPoints[robotLetterToArrayIndex(map[xloc][yloc-1])] = 0;
+                    map[xloc][yloc-1]='.';
+                }
+                return STATUS_ACTION_WEAPON_SUCCESS;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else
+    {
+        return STATUS_ACTION_WEAPON_FAIL;
+    }
+
+    return STATUS_ACTION_WEAPON_NOT_IMPLEMENTED;
+}
+
+int updateHealthPointsForShootAction(int healthPoints[MAX_NUM_ROBOTS],
+                                     char map[MAX_ROWS][MAX_COLS],
+                                     const int mapRows, const int mapCols,
+                                     const int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS],
+                                     const char robotLetter,
+                                     const char directionLetter,
+                                     char &targetRobotLetter,
+                                     int &targetOriginalHealthPoint,
+                                     int &targetUpdatedHealthPoint,
+                                     const int damage)
+{
+    int xloc = 0;
+    int yloc = 0;
+    int stop = 0;
+    for(int i = 0; i < mapRows; i++)
+    {
+        for(int j = 0; j < mapCols; j++)
+        {
+            if(map[i][j] == robotLetter && stop == 0)
+            {
+                xloc = i;
+                yloc = j;
+                stop += 1;
+            }
+        }
+    }
+    // a shot stops short of the first wall
+    const int *walls = wallDistances[xloc][yloc];
+    if(directionLetter == DIRECTION_SOUTH){
+        if(xloc+1 < mapRows)
+        {
+            if(xloc+5 < mapRows)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range <= WEAPON_SHOOT_RANGE && range < walls[DIRECTION_INDEX_SOUTH]; range++)
+                {
+                    if(map[xloc+range][yloc]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        
+                        targetRobotLetter = map[xloc+range][yloc];
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] - damage;
+                        healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] -= damage;
+
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] = 0;
+                            map[xloc+range][yloc]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                                
+                    }
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+                
+            }
+            else if(xloc+5 >= mapRows)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range < mapRows-xloc && range < walls[DIRECTION_INDEX_SOUTH]; range++)
+                {
+                    if(map[xloc+range][yloc]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] -= damage;
+                        targetRobotLetter = map[xloc+range][yloc];
+                        
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] = 0;
+                            map[xloc+range][yloc]='.';
+                        }
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                    }
+                    
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_NORTH){
+        if(xloc-1 >= 0)
+        {
+            if(xloc-5 >= 0)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range <= WEAPON_SHOOT_RANGE && range < walls[DIRECTION_INDEX_NORTH]; range++)
+                {
+                    if(map[xloc-range][yloc]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        
+                        targetRobotLetter = map[xloc-range][yloc];
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc-range][yloc])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc-range][yloc])] - damage;
+                        healthPoints[robotLetterToArrayIndex(map[xloc-range][yloc])] -= damage;
+
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc-range][yloc])] = 0;
+                            map[xloc-range][yloc]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                                
+                    }
+                     
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+                
+            }
+            else if(xloc-5 < 0)
+            {
+                int maxshoot = 0;
+                for(int range = xloc-1; range >= 0 && xloc-range < walls[DIRECTION_INDEX_NORTH]; range--)
+                {
+                    if(map[range][yloc]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[range][yloc])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[range][yloc])] -= damage;
+                        targetRobotLetter = map[range][yloc];
+                        
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[range][yloc])] = 0;
+                            map[range][yloc]='.';
+                        }
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                    }
+                    
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+                
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_EAST){
+        if(yloc+1 < mapCols)
+        {
+            if(yloc+5 < mapCols)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range <= WEAPON_SHOOT_RANGE && range < walls[DIRECTION_INDEX_EAST]; range++)
+                {
+                    if(map[xloc][yloc+range]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        
+                        targetRobotLetter = map[xloc][yloc+range];
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] - damage;
+                        healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] -= damage;
+
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] = 0;
+                            map[xloc][yloc+range]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;           
+                    }
+                    
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+               
+            }
+            else if(yloc+5 >= mapCols)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range < mapCols-yloc && range < walls[DIRECTION_INDEX_EAST]; range++)
+                {
+                    if(map[xloc][yloc+range]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] -= damage;
+                        targetRobotLetter = map[xloc][yloc+range];  
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] = 0;
+                            map[xloc][yloc+range]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;   
+                    }
+                    
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_WEST){
+        if(yloc-1 >= 0)
+        {
+            if(yloc-5 >= 0)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range <= WEAPON_SHOOT_RANGE && range < walls[DIRECTION_INDEX_WEST]; range++)
+                {
+                    if(map[xloc][yloc-range]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        
+                        targetRobotLetter = map[xloc][yloc-range];
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc-range])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc-range])] - damage;
+                        healthPoints[robotLetterToArrayIndex(map[xloc][yloc-range])] -= damage;
+
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc][yloc-range])] = 0;
+                            map[xloc][yloc-range]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;     
+                    }
+                
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+            else if(yloc-5 < 0)
+            {
+                int maxshoot = 0;
+                for(int range = yloc-1; range >= 0 && yloc-range < walls[DIRECTION_INDEX_WEST]; range--)
+                {
+                    if(map[xloc][range]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][range])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][range])] -= damage;
+                        targetRobotLetter = map[xloc][range];
+                        
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc][range])] = 0;
+                            map[xloc][range]='.';
+                        }
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                    }
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+               
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else
+    {
+        return STATUS_ACTION_WEAPON_FAIL;
+    }
+
+    return STATUS_ACTION_WEAPON_NOT_IMPLEMENTED;
+}
+
+int updateMapForMoveAction(char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                           const int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS],
+                           const char robotLetter, const char directionLetter, const int moveSteps)
+{
+    // remove this line to start your work
+    for(int i = 0; i < mapRows; i++)
+    {
+        for(int j = 0; j < mapCols; j++)
+        {
+            if(map[i][j] == robotLetter)
+            {
+                int xloc = i;
+                int yloc = j;
+                int block = 0;
+                if(directionLetter == DIRECTION_EAST)
+                {
+                    if(yloc+1 < mapCols)
+                    {
+                        if(moveSteps >= wallDistances[xloc][yloc][DIRECTION_INDEX_EAST])
+                        {
+                            return STATUS_ACTION_MOVE_HIT_WALL_ALONG_PATH;
+                        }
+                        int checkblock = 0;
+                        for(int y = yloc+1; y <= moveSteps; y++)
+                        {
+                            if(map[xloc][y] != CHAR_EMPTY)
+                            {
+                                checkblock += 1;
+                            } 
+                        }
+                        if(checkblock == 0)
+                        {
+                            if(yloc+moveSteps < mapCols)
+                            {
+                                map[xloc][yloc]= CHAR_EMPTY;
+                                map[xloc][yloc+moveSteps] = robotLetter;
+                                return STATUS_ACTION_MOVE_SUCCESS;
+                            }
+                            else
+                            {
+                                return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                            }
+                        }
+                        else
+                        {
+                            return STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH;
+                        }
+                    }
+                    else
+                    {
+                        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                    }
+                }
+                else if(directionLetter == DIRECTION_WEST)
+                {
+                    if(yloc-1>= 0)
+                    {
+                        if(moveSteps >= wallDistances[xloc][yloc][DIRECTION_INDEX_WEST])
+                        {
+                            return STATUS_ACTION_MOVE_HIT_WALL_ALONG_PATH;
+                        }
+                        int checkblock = 0;
+                        for(int y = yloc-1; y >= yloc-moveSteps; y--)
+                        {
+                           if(map[xloc][y] != CHAR_EMPTY)
+                            {
+                                checkblock += 1;
+                            } 
+                        }
+                        if(checkblock == 0)
+                        {   if(yloc-moveSteps >= 0)
+                            {
+                                map[xloc][yloc]= CHAR_EMPTY;
+                                map[xloc][yloc-moveSteps] = robotLetter;
+                                return STATUS_ACTION_MOVE_SUCCESS;
+                            }
+                            else
+                            {
+                                return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                            }
+                        }
+                        else
+                        {
+                            return STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH;
+                        }
+                    }
+                    else
+                    {
+                        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                    }
+                }
+                else if(directionLetter == DIRECTION_SOUTH)
+                {
+                    if(xloc+1 < mapRows)
+                    {
+                        if(moveSteps >= wallDistances[xloc][yloc][DIRECTION_INDEX_SOUTH])
+                        {
+                            return STATUS_ACTION_MOVE_HIT_WALL_ALONG_PATH;
+                        }
+                        int checkblock = 0;
+                        for(int x = xloc+1; x <= moveSteps; x++)
+                        {
+                           if(map[x][yloc] != CHAR_EMPTY)
+                            {
+                                checkblock += 1;
+                            } 
+                        }
+                        if(checkblock == 0)
+                        {
+                            if(xloc+moveSteps < mapRows)
+                            {
+                                map[xloc][yloc]= CHAR_EMPTY;
+                                map[xloc+moveSteps][yloc] = robotLetter;
+                                return STATUS_ACTION_MOVE_SUCCESS;
+                            }
+                            else
+                            {
+                                return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                            }
+                        }
+                        else
+                        {
+                            return STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH;
+                        }
+                    }
+                    else
+                    {
+                        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                    }
+                        
+                }
+                else if(directionLetter == DIRECTION_NORTH)
+                {
+                
+                    if(xloc-1 >= 0)
+                    {
+                        if(moveSteps >= wallDistances[xloc][yloc][DIRECTION_INDEX_NORTH])
+                        {
+                            return STATUS_ACTION_MOVE_HIT_WALL_ALONG_PATH;
+                        }
+                        int checkblock = 0;
+                        for(int x = xloc-1; x >= xloc-moveSteps; x--)
+                        {
+                           if(map[x][yloc] != CHAR_EMPTY)
+                            {
+                                checkblock += 1;
+                            } 
+                        }
+                        if(checkblock == 0)
+                        {
+                            if(xloc-moveSteps >= 0)
+                            {
+                                map[xloc][yloc]= CHAR_EMPTY;
+                                map[xloc-moveSteps][yloc] = robotLetter;
+                                return STATUS_ACTION_MOVE_SUCCESS;
+                            }
+                            {
+                                return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                            }
+                        }
+                        else
+                        {
+                            return STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH;
+                        }
+                    }
+                    else
+                    {
+                        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                    }
+                }
+            }
+        }
+    }
+    return STATUS_ACTION_MOVE_NOT_IMPLMENTED;
+}
+
+// Helper function: find the row and column of a robot on the map
+// Returns false if the robot is not on the map
+bool findRobotLocation(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                       const char robotLetter, int &robotRow, int &robotCol)
+{
+    int r, c;
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            if (map[r][c] == robotLetter)
+            {
+                robotRow = r;
+                robotCol = c;
+                return true;
+            }
+    return false;
+}
+
+// Helper function: compute the distance from every cell to the first wall in each direction
+// One sweep per direction, each cell taking the distance of its neighbour plus one
+void computeWallDistances(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                          int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS])
+{
+    int r, c;
+    for (r = 0; r < mapRows; r++)
+    {
+        for (c = mapCols - 1; c >= 0; c--)
+            wallDistances[r][c][DIRECTION_INDEX_EAST] =
+                (c + 1 >= mapCols) ? WALL_DISTANCE_NONE
+                : (map[r][c + 1] == CHAR_WALL) ? 1
+                : (wallDistances[r][c + 1][DIRECTION_INDEX_EAST] == WALL_DISTANCE_NONE) ? WALL_DISTANCE_NONE
+                : wallDistances[r][c + 1][DIRECTION_INDEX_EAST] + 1;
+        for (c = 0; c < mapCols; c++)
+            wallDistances[r][c][DIRECTION_INDEX_WEST] =
+                (c == 0) ? WALL_DISTANCE_NONE
+                : (map[r][c - 1] == CHAR_WALL) ? 1
+                : (wallDistances[r][c - 1][DIRECTION_INDEX_WEST] == WALL_DISTANCE_NONE) ? WALL_DISTANCE_NONE
+                : wallDistances[r][c - 1][DIRECTION_INDEX_WEST] + 1;
+    }
+    for (c = 0; c < mapCols; c++)
+    {
+        for (r = mapRows - 1; r >= 0; r--)
+            wallDistances[r][c][DIRECTION_INDEX_SOUTH] =
+                (r + 1 >= mapRows) ? WALL_DISTANCE_NONE
+                : (map[r + 1][c] == CHAR_WALL) ? 1
+                : (wallDistances[r + 1][c][DIRECTION_INDEX_SOUTH] == WALL_DISTANCE_NONE) ? WALL_DISTANCE_NONE
+                : wallDistances[r + 1][c][DIRECTION_INDEX_SOUTH] + 1;
+        for (r = 0; r < mapRows; r++)
+            wallDistances[r][c][DIRECTION_INDEX_NORTH] =
+                (r == 0) ? WALL_DISTANCE_NONE
+                : (map[r - 1][c] == CHAR_WALL) ? 1
+                : (wallDistances[r - 1][c][DIRECTION_INDEX_NORTH] == WALL_DISTANCE_NONE) ? WALL_DISTANCE_NONE
+                : wallDistances[r - 1][c][DIRECTION_INDEX_NORTH] + 1;
+    }
+}
+
+// Helper function: the cell a line of sight to (rowOffset, colOffset) passes at a step, as offsets
+// The line takes max(|rowOffset|, |colOffset|) steps and each step rounds to the nearest cell, half
+// away from zero, so a line and its mirror images pass mirrored cells
+void getLineOfSightCell(const int rowOffset, const int colOffset, const int step, int &row, int &col)
+{
+    const int steps = max(abs(rowOffset), abs(colOffset));
+    row = (rowOffset >= 0) ? (2 * rowOffset * step + steps) / (2 * steps) : -((-2 * rowOffset * step + steps) / (2 * steps));
+    col = (colOffset >= 0) ? (2 * colOffset * step + steps) / (2 * steps) : -((-2 * colOffset * step + steps) / (2 * steps));
+}
+
+// Helper function: move the bits of a map row by a number of columns, towards the east if positive
+uint32_t shiftRowBits(const uint32_t bits, const int cols)
+{
+    return (cols >= 0) ? bits << cols : bits >> -cols;
+}
+
+// Helper function: mark every cached distance field as empty
+void initializeDistanceFields(DistanceField distanceFields[MAX_NUM_DISTANCE_FIELDS])
+{
+    int i;
+    for (i = 0; i < MAX_NUM_DISTANCE_FIELDS; i++)
+    {
+        distanceFields[i].valid = false;
+        distanceFields[i].lastUsed = 0;
+    }
+}
+
+// Helper function: breadth-first search from the target cell over the empty cells
+// Every step costs the same, so this gives the same distances as A* without a heuristic.
+// The target counts as empty, so the field stays right while a robot stands on it.
+void computeDistanceField(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                          DistanceField &field)
+{
+    int queueRows[MAX_ROWS * MAX_COLS], queueCols[MAX_ROWS * MAX_COLS];
+    const int stepRows[4] = {-1, 0, 1, 0};
+    const int stepCols[4] = {0, 1, 0, -1};
+    int head = 0, tail = 0;
+    int r, c, d;
+
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            field.distance[r][c] = (map[r][c] == CHAR_EMPTY) ? DISTANCE_UNREACHABLE : DISTANCE_BLOCKED;
+
+    field.distance[field.targetRow][field.targetCol] = 0;
+    queueRows[tail] = field.targetRow;
+    queueCols[tail] = field.targetCol;
+    tail++;
+    while (head < tail)
+    {
+        r = queueRows[head];
+        c = queueCols[head];
+        head++;
+        for (d = 0; d < 4; d++)
+        {
+            int nr = r + stepRows[d], nc = c + stepCols[d];
+            if (nr < 0 || nr >= mapRows || nc < 0 || nc >= mapCols)
+                continue;
+            if (field.distance[nr][nc] != DISTANCE_UNREACHABLE)
+                continue;
+            field.distance[nr][nc] = field.distance[r][c] + 1;
+            queueRows[tail] = nr;
+            queueCols[tail] = nc;
+            tail++;
+        }
+    }
+}
+
+// Helper function: take a cell that became occupied out of a distance field
+// Only the cells whose shortest paths all went through it change. They are the cells left
+// without a neighbour one step closer to the target, found level by level from the cell; they
+// are then searched again from the cells around them, closest first.
+void blockDistanceFieldCell(DistanceField &field, const int mapRows, const int mapCols, const int row, const int col)
+{
+    int queueRows[MAX_ROWS * MAX_COLS], queueCols[MAX_ROWS * MAX_COLS];
+    int seeds[MAX_ROWS * MAX_COLS]; // distance * MAX_ROWS * MAX_COLS + cell, so sorting orders by distance
+    const int stepRows[4] = {-1, 0, 1, 0};
+    const int stepCols[4] = {0, 1, 0, -1};
+    int head = 0, tail = 0, numSeeds = 0, nextSeed = 0;
+    int r, c, d, e, i;
+
+    const int blockedDistance = field.distance[row][col];
+    field.distance[row][col] = DISTANCE_BLOCKED;
+    if (blockedDistance < 0)
+        return; // no path went through it
+
+    // The cells left without a closer neighbour lose their distance; they are found in order of
+    // their old distance, so a cell's closer neighbours are all settled when it is checked
+    queueRows[tail] = row;
+    queueCols[tail] = col;
+    tail++;
+    int levelDistance = blockedDistance;
+    int levelEnd = tail;
+    while (head < tail)
+    {
+        if (head == levelEnd)
+        {
+            levelDistance++;
+            levelEnd = tail;
+        }
+        r = queueRows[head];
+        c = queueCols[head];
+        head++;
+        for (d = 0; d < 4; d++)
+        {
+            int nr = r + stepRows[d], nc = c + stepCols[d];
+            if (nr < 0 || nr >= mapRows || nc < 0 || nc >= mapCols || field.distance[nr][nc] != levelDistance + 1)
+                continue;
+            bool hasCloserNeighbour = false;
+            for (e = 0; e < 4 && !hasCloserNeighbour; e++)
+            {
+                int cr = nr + stepRows[e], cc = nc + stepCols[e];
+                if (cr >= 0 && cr < mapRows && cc >= 0 && cc < mapCols && field.distance[cr][cc] == levelDistance)
+                    hasCloserNeighbour = true;
+            }
+            if (hasCloserNeighbour)
+                continue;
+            field.distance[nr][nc] = DISTANCE_UNREACHABLE;
+            queueRows[tail] = nr;
+            queueCols[tail] = nc;
+            tail++;
+        }
+    }
+
+    // Every cell that lost its distance and touches a cell that kept one starts a search from there
+    for (i = 1; i < tail; i++)
+    {
+        int best = DISTANCE_UNREACHABLE;
+        for (d = 0; d < 4; d++)
+        {
+            int nr = queueRows[i] + stepRows[d], nc = queueCols[i] + stepCols[d];
+            if (nr >= 0 && nr < mapRows && nc >= 0 && nc < mapCols && field.distance[nr][nc] >= 0 &&
+                (best == DISTANCE_UNREACHABLE || field.distance[nr][nc] < best))
+                best = field.distance[nr][nc];
+        }
+        if (best != DISTANCE_UNREACHABLE)
+            seeds[numSeeds++] = (best + 1) * MAX_ROWS * MAX_COLS + queueRows[i] * MAX_COLS + queueCols[i];
+    }
+    sort(seeds, seeds + numSeeds);
+
+    // Breadth-first search that takes in the sorted starts as the queue reaches their distance
+    head = tail = 0;
+    while (head < tail || nextSeed < numSeeds)
+    {
+        if (nextSeed < numSeeds &&
+            (head == tail || seeds[nextSeed] / (MAX_ROWS * MAX_COLS) <= field.distance[queueRows[head]][queueCols[head]]))
+        {
+            const int cell = seeds[nextSeed] % (MAX_ROWS * MAX_COLS);
+            r = cell / MAX_COLS;
+            c = cell % MAX_COLS;
+            if (field.distance[r][c] == DISTANCE_UNREACHABLE)
+            {
+                field.distance[r][c] = seeds[nextSeed] / (MAX_ROWS * MAX_COLS);
+                queueRows[tail] = r;
+                queueCols[tail] = c;
+                tail++;
+            }
+            nextSeed++;
+            continue;
+        }
+        r = queueRows[head];
+        c = queueCols[head];
+        head++;
+        for (d = 0; d < 4; d++)
+        {
+            int nr = r + stepRows[d], nc = c + stepCols[d];
+            if (nr < 0 || nr >= mapRows || nc < 0 || nc >= mapCols || field.distance[nr][nc] != DISTANCE_UNREACHABLE)
+                continue;
+            field.distance[nr][nc] = field.distance[r][c] + 1;
+            queueRows[tail] = nr;
+            queueCols[tail] = nc;
+            tail++;
+        }
+    }
+}
+
+// Helper function: add a cell that became empty to a distance field
+// The cell is one step further than its closest neighbour, and the cells it gives a shorter
+// path to, or a path at all, are updated by a breadth-first search from it
+void openDistanceFieldCell(DistanceField &field, const int mapRows, const int mapCols, const int row, const int col)
+{
+    int queueRows[MAX_ROWS * MAX_COLS], queueCols[MAX_ROWS * MAX_COLS];
+    const int stepRows[4] = {-1, 0, 1, 0};
+    const int stepCols[4] = {0, 1, 0, -1};
+    int head = 0, tail = 0;
+    int r, c, d;
+
+    int best = DISTANCE_UNREACHABLE;
+    for (d = 0; d < 4; d++)
+    {
+        int nr = row + stepRows[d], nc = col + stepCols[d];
+        if (nr >= 0 && nr < mapRows && nc >= 0 && nc < mapCols && field.distance[nr][nc] >= 0 &&
+            (best == DISTANCE_UNREACHABLE || field.distance[nr][nc] < best))
+            best = field.distance[nr][nc];
+    }
+    if (best == DISTANCE_UNREACHABLE)
+    {
+        field.distance[row][col] = DISTANCE_UNREACHABLE;
+        return;
+    }
+
+    field.distance[row][col] = best + 1;
+    queueRows[tail] = row;
+    queueCols[tail] = col;
+    tail++;
+    while (head < tail)
+    {
+        r = queueRows[head];
+        c = queueCols[head];
+        head++;
+        for (d = 0; d < 4; d++)
+        {
+            int nr = r + stepRows[d], nc = c + stepCols[d];
+            if (nr < 0 || nr >= mapRows || nc < 0 || nc >= mapCols)
+                continue;
+            if (field.distance[nr][nc] != DISTANCE_UNREACHABLE && field.distance[nr][nc] <= field.distance[r][c] + 1)
+                continue; // blocked, or already as close
+            field.distance[nr][nc] = field.distance[r][c] + 1;
+            queueRows[tail] = nr;
+            queueCols[tail] = nc;
+            tail++;
+        }
+    }
+}
+
+// Helper function: bring the cached distance fields up to date with a cell changing its occupancy
+// Whoever changes the map calls this for every cell that became occupied or empty. A field's
+// target counts as empty whatever is on it (moveto never looks up an occupied target), so a
+// change there changes nothing.
+void updateDistanceFields(DistanceField distanceFields[MAX_NUM_DISTANCE_FIELDS], const int mapRows,
+                          const int mapCols, const int row, const int col, const bool occupied)
+{
+    int i;
+    for (i = 0; i < MAX_NUM_DISTANCE_FIELDS; i++)
+    {
+        DistanceField &field = distanceFields[i];
+        if (!field.valid || (row == field.targetRow && col == field.targetCol))
+            continue;
+        if (occupied)
+            blockDistanceFieldCell(field, mapRows, mapCols, row, col);
+        else
+            openDistanceFieldCell(field, mapRows, mapCols, row, col);
+    }
+}
+
+// Helper function: get the distance field of a target cell from the cache
+// A cached field is still correct, as updateDistanceFields repairs it on every change;
+// numSearches counts the fields that had to be searched from scratch
+DistanceField &lookupDistanceField(DistanceField distanceFields[MAX_NUM_DISTANCE_FIELDS],
+                                   const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                                   const int targetRow, const int targetCol, int &clock, int &numSearches)
+{
+    int i;
+    int oldest = 0;
+    clock++;
+
+    for (i = 0; i < MAX_NUM_DISTANCE_FIELDS; i++)
+    {
+        DistanceField &field = distanceFields[i];
+        if (field.valid && field.targetRow == targetRow && field.targetCol == targetCol)
+        {
+            field.lastUsed = clock;
+            return field;
+        }
+        if (!distanceFields[oldest].valid)
+            continue;
+        if (!field.valid || field.lastUsed < distanceFields[oldest].lastUsed)
+            oldest = i;
+    }
+
+    DistanceField &field = distanceFields[oldest];
+    field.valid = true;
+    field.targetRow = targetRow;
+    field.targetCol = targetCol;
+    field.lastUsed = clock;
+    computeDistanceField(map, mapRows, mapCols, field);
+    numSearches++;
+    return field;
+}
+
+int updateMapForMoveToAction(char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                             DistanceField distanceFields[MAX_NUM_DISTANCE_FIELDS], int &distanceFieldClock,
+                             int &numDistanceFieldSearches, const char robotLetter,
+                             const int targetRow, const int targetCol, int &pathSteps)
+{
+    int robotRow, robotCol;
+    int best = DISTANCE_UNREACHABLE;
+
+    pathSteps = 0;
+    if (!findRobotLocation(map, mapRows, mapCols, robotLetter, robotRow, robotCol))
+        return STATUS_ACTION_MOVE_NOT_IMPLMENTED;
+
+    if (targetRow < 0 || targetRow >= mapRows || targetCol < 0 || targetCol >= mapCols)
+        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+
+    if (targetRow == robotRow && targetCol == robotCol)
+        return STATUS_ACTION_MOVE_SUCCESS;
+
+    if (map[targetRow][targetCol] != CHAR_EMPTY)
+        return STATUS_ACTION_MOVE_NO_PATH;
+
+    const DistanceField &field = lookupDistanceField(distanceFields, map, mapRows, mapCols,
+                                                     targetRow, targetCol, distanceFieldClock,
+                                                     numDistanceFieldSearches);
+
+    // The robot's own cell is occupied, so its distance is one more than its closest neighbour
+    if (robotRow > 0 && field.distance[robotRow - 1][robotCol] >= 0)
+        best = field.distance[robotRow - 1][robotCol];
+    if (robotRow + 1 < mapRows && field.distance[robotRow + 1][robotCol] >= 0 &&
+        (best == DISTANCE_UNREACHABLE || field.distance[robotRow + 1][robotCol] < best))
+        best = field.distance[robotRow + 1][robotCol];
+    if (robotCol > 0 && field.distance[robotRow][robotCol - 1] >= 0 &&
+        (best == DISTANCE_UNREACHABLE || field.distance[robotRow][robotCol - 1] < best))
+        best = field.distance[robotRow][robotCol - 1];
+    if (robotCol + 1 < mapCols && field.distance[robotRow][robotCol + 1] >= 0 &&
+        (best == DISTANCE_UNREACHABLE || field.distance[robotRow][robotCol + 1] < best))
+        best = field.distance[robotRow][robotCol + 1];
+
+    if (best == DISTANCE_UNREACHABLE)
+        return STATUS_ACTION_MOVE_NO_PATH;
+
+    pathSteps = best + 1;
+    map[robotRow][robotCol] = CHAR_EMPTY;
+    map[targetRow][targetCol] = robotLetter;
+    return STATUS_ACTION_MOVE_SUCCESS;
+}
+
+// Helper function: random events off, every attack lands for its full damage
+void initializeRandomEvents(RandomEvents &events)
+{
+    events.seed = 0;
+    events.hitChance = HIT_CHANCE_ALWAYS;
+    events.damageVariance = 0;
+}
+
+// Roll whether the attack of a robot in a turn lands and how much damage it does
+// Returns false on a miss. The draw depends only on the seed, the turn and the robot, so the
+// same command in the same turn always rolls the same, whoever resolves it
+bool rollWeaponAttack(const RandomEvents &events, const int turn, const int robotIndex,
+                      const int baseDamage, int &damage)
+{
+    damage = baseDamage;
+    if (events.hitChance >= HIT_CHANCE_ALWAYS && events.damageVariance <= 0)
+        return true;
+
+    const uint32_t counter[4] = {uint32_t(turn), uint32_t(robotIndex), 0, 0};
+    const uint32_t key[2] = {uint32_t(events.seed), uint32_t(events.seed >> 32)};
+    uint32_t random[4];
+    philox4x32(counter, key, random);
+    if (int(philoxBelow(random[0], HIT_CHANCE_ALWAYS)) >= events.hitChance)
+        return false;
+    if (events.damageVariance > 0)
+    {
+        const int variance = int(philoxBelow(random[1], uint32_t(2 * events.damageVariance + 1))) - events.damageVariance;
+        damage = baseDamage + baseDamage * variance / 100;
+        if (damage < 0)
+            damage = 0;
+    }
+    return true;
+}
+
+// Apply the same change to the health points of every alive robot (health points above 0);
+// a negative change is damage. As in the weapon actions, a robot whose health points drop to 0
+// or below is set to 0. The robots destroyed by this change are listed compactly in
+// destroyedIndices, with their health points before the change in destroyedHealthPoints,
+// so the caller only has to clear their cells. Returns how many robots were destroyed.
+int applyHealthPointsEffect(int healthPoints[], const int numRobots, const int change,
+                            int destroyedIndices[], int destroyedHealthPoints[])
+{
+    int numDestroyed = 0;
+    int i = 0;
+
+#ifdef __SSE2__
+    // 4 robots at a time: add the change under the alive mask, then zero the lanes that died
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i changes = _mm_set1_epi32(change);
+    for (; i + 4 <= numRobots; i += 4)
+    {
+        __m128i before = _mm_loadu_si128((const __m128i *)(healthPoints + i));
+        __m128i alive = _mm_cmpgt_epi32(before, zero);
+        __m128i after = _mm_add_epi32(before, _mm_and_si128(changes, alive));
+        __m128i destroyed = _mm_andnot_si128(_mm_cmpgt_epi32(after, zero), alive);
+        _mm_storeu_si128((__m128i *)(healthPoints + i), _mm_andnot_si128(destroyed, after));
+
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(destroyed));
+        if (mask != 0)
+        {
+            int beforeLanes[4];
+            _mm_storeu_si128((__m128i *)beforeLanes, before);
+            for (int lane = 0; lane < 4; lane++)
+                if (mask & (1 << lane))
+                {
+                    destroyedIndices[numDestroyed] = i + lane;
+                    destroyedHealthPoints[numDestroyed] = beforeLanes[lane];
+                    numDestroyed++;
+                }
+        }
+    }
+#endif
+
+    for (; i < numRobots; i++)
+    {
+        int before = healthPoints[i];
+        if (before <= 0)
+            continue;
+        if (before + change <= 0)
+        {
+            healthPoints[i] = 0;
+            destroyedIndices[numDestroyed] = i;
+            destroyedHealthPoints[numDestroyed] = before;
+            numDestroyed++;
+        }
+        else
+        {
+            healthPoints[i] = before + change;
+        }
+    }
+    return numDestroyed;
+}
+
+Game::Game()
+{
+    mapRows = mapCols = 0;
+    initializeMap(map, MAX_ROWS, MAX_COLS);
+    initializeHealthPoints(healthPoints);
+    initializeDistanceFields(distanceFields);
+    distanceFieldClock = numDistanceFieldSearches = 0;
+    for (int i = 0; i < MAX_NUM_ROBOTS; i++)
+    {
+        robotRows[i] = robotCols[i] = ROBOT_NOT_ON_MAP;
+        robotTeams[i] = 0;
+    }
+    for (int team = 0; team < MAX_NUM_TEAMS; team++)
+        teamStatistics[team].aliveCount = teamStatistics[team].totalHealthPoints = teamStatistics[team].kills = 0;
+    numTeamsAlive = aliveTeamsSum = 0;
+    for (int r = 0; r < MAX_ROWS; r++)
+    {
+        occupiedBits[r] = 0;
+        for (int team = 0; team < MAX_NUM_TEAMS; team++)
+            teamBits[team][r] = visibleBits[team][r] = reachableBits[team][r] = 0;
+    }
+    for (int team = 0; team < MAX_NUM_TEAMS; team++)
+        visibilityDirty[team] = true;
+    visibilityRadius = VISIBILITY_RADIUS;
+    initializeRandomEvents(randomEvents);
+    turn = 0;
+}
+
+bool Game::load(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                const int healthPoints[MAX_NUM_ROBOTS], const int teams[MAX_NUM_ROBOTS])
+{
+    int r, c, i, team;
+    if (mapRows < 1 || mapRows > MAX_ROWS || mapCols < 1 || mapCols > MAX_COLS)
+        return false;
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            if (!isMapCellValid(map[r][c]))
+                return false;
+
+    this->mapRows = mapRows;
+    this->mapCols = mapCols;
+    // the move checks can read past the map edge, so nothing may be left there from a previous game
+    initializeMap(this->map, MAX_ROWS, MAX_COLS);
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            this->map[r][c] = map[r][c];
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+        this->healthPoints[i] = healthPoints[i];
+    computeWallDistances(map, mapRows, mapCols, wallDistances);
+    initializeDistanceFields(distanceFields);
+    distanceFieldClock = numDistanceFieldSearches = 0;
+    turn = 0;
+
+    // Remember where every robot is, so effects on all robots can clear cells without a scan
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+        robotRows[i] = robotCols[i] = ROBOT_NOT_ON_MAP;
+    for (r = mapRows - 1; r >= 0; r--)
+        for (c = mapCols - 1; c >= 0; c--)
+            if (map[r][c] >= 'A' && map[r][c] <= 'Z')
+            {
+                // scanning backwards keeps the first occurrence, the one the actions find
+                robotRows[robotLetterToArrayIndex(map[r][c])] = r;
+                robotCols[robotLetterToArrayIndex(map[r][c])] = c;
+            }
+
+    // The team numbers are only ever updated from here on, never recounted
+    for (team = 0; team < MAX_NUM_TEAMS; team++)
+        teamStatistics[team].aliveCount = teamStatistics[team].totalHealthPoints = teamStatistics[team].kills = 0;
+    numTeamsAlive = aliveTeamsSum = 0;
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+    {
+        team = (teams != NULL && teams[i] >= 0 && teams[i] < MAX_NUM_TEAMS) ? teams[i] : 0;
+        robotTeams[i] = team;
+        if (healthPoints[i] <= 0)
+            continue;
+        if (teamStatistics[team].aliveCount == 0)
+        {
+            numTeamsAlive++;
+            aliveTeamsSum += team;
+        }
+        teamStatistics[team].aliveCount++;
+        teamStatistics[team].totalHealthPoints += healthPoints[i];
+    }
+
+    // Bit-packed occupancy and team positions for the visibility masks
+    for (r = 0; r < MAX_ROWS; r++)
+    {
+        occupiedBits[r] = 0;
+        for (team = 0; team < MAX_NUM_TEAMS; team++)
+            teamBits[team][r] = 0;
+    }
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            if (map[r][c] != CHAR_EMPTY)
+                occupiedBits[r] |= 1u << c;
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+        if (robotRows[i] != ROBOT_NOT_ON_MAP && healthPoints[i] > 0)
+            teamBits[robotTeams[i]][robotRows[i]] |= 1u << robotCols[i];
+    for (team = 0; team < MAX_NUM_TEAMS; team++)
+        visibilityDirty[team] = true;
+    return true;
+}
+
+ActionResult Game::apply(const Command &command)
+{
+    ActionResult result;
+    result.status = STATUS_ACTION_WEAPON_NOT_IMPLEMENTED; // unknown actions are not implemented
+    result.targetRobotLetter = CHAR_EMPTY;
+    result.targetOriginalHealthPoint = 0;
+    result.targetUpdatedHealthPoint = 0;
+    result.pathSteps = 0;
+
+    // The path check of the move action does not cover the whole path, so a robot can land on
+    // another one and remove it from the map; remember who is at the destination
+    char displacedLetter = CHAR_EMPTY;
+    int destinationRow, destinationCol;
+    if (getMoveDestination(command, destinationRow, destinationCol))
+        displacedLetter = map[destinationRow][destinationCol];
+
+    if (command.actionLetter == ACTION_MOVE)
+    {
+        result.status = updateMapForMoveAction(map, mapRows, mapCols, wallDistances, command.robotLetter,
+                                               command.directionLetter, command.moveSteps);
+    }
+    else if (command.actionLetter == ACTION_MOVETO)
+    {
+        result.status = updateMapForMoveToAction(map, mapRows, mapCols, distanceFields, distanceFieldClock,
+                                                 numDistanceFieldSearches, command.robotLetter,
+                                                 command.targetRow, command.targetCol, result.pathSteps);
+    }
+    else if (command.actionLetter == ACTION_HIT || command.actionLetter == ACTION_SHOOT)
+    {
+        result.status = applyWeaponAction(command, result);
+    }
+    if ((command.actionLetter == ACTION_HIT || command.actionLetter == ACTION_SHOOT) &&
+        result.status == STATUS_ACTION_WEAPON_SUCCESS)
+        damageRobot(robotLetterToArrayIndex(result.targetRobotLetter), result.targetOriginalHealthPoint,
+                    result.targetUpdatedHealthPoint, robotLetterToArrayIndex(command.robotLetter));
+    updateRobotLocationsAfter(command, result, displacedLetter);
+    turn++;
+    return result;
+}
+
+// Resolve a hit or shoot on the given copy of the map and health points with the given damage
+int Game::resolveWeaponAction(char stateMap[MAX_ROWS][MAX_COLS], int stateHealthPoints[MAX_NUM_ROBOTS],
+                              const Command &command, ActionResult &result, const int damage) const
+{
+    if (command.actionLetter == ACTION_HIT)
+        return updateHealthPointsForHitAction(stateHealthPoints, stateMap, mapRows, mapCols, wallDistances,
+                                              command.robotLetter, command.directionLetter,
+                                              result.targetRobotLetter, result.targetOriginalHealthPoint,
+                                              result.targetUpdatedHealthPoint, damage);
+    return updateHealthPointsForShootAction(stateHealthPoints, stateMap, mapRows, mapCols, wallDistances,
+                                            command.robotLetter, command.directionLetter,
+                                            result.targetRobotLetter, result.targetOriginalHealthPoint,
+                                            result.targetUpdatedHealthPoint, damage);
+}
+
+// Resolve a hit or shoot with the random events
+// The attack is only rolled once the weapon has a target, so a miss always means a target was
+// missed; with random events on, the target is found by resolving the command on scratch copies
+int Game::applyWeaponAction(const Command &command, ActionResult &result)
+{
+    const int baseDamage = (command.actionLetter == ACTION_HIT) ? WEAPON_HIT_DAMAGE : WEAPON_SHOOT_DAMAGE;
+    int damage = baseDamage;
+    if (randomEvents.hitChance < HIT_CHANCE_ALWAYS || randomEvents.damageVariance > 0)
+    {
+        char scratchMap[MAX_ROWS][MAX_COLS];
+        int scratchHealthPoints[MAX_NUM_ROBOTS];
+        ActionResult scratchResult = result;
+        memcpy(scratchMap, map, sizeof(scratchMap));
+        memcpy(scratchHealthPoints, healthPoints, sizeof(scratchHealthPoints));
+        if (resolveWeaponAction(scratchMap, scratchHealthPoints, command, scratchResult, damage) == STATUS_ACTION_WEAPON_SUCCESS &&
+            !rollWeaponAttack(randomEvents, turn, robotLetterToArrayIndex(command.robotLetter), baseDamage, damage))
+            return STATUS_ACTION_WEAPON_MISS;
+    }
+    return resolveWeaponAction(map, healthPoints, command, result, damage);
+}
+
+// Where a move or moveto command would put the robot, if that is on the map
+bool Game::getMoveDestination(const Command &command, int &row, int &col) const
+{
+    if (command.actionLetter == ACTION_MOVETO)
+    {
+        row = command.targetRow;
+        col = command.targetCol;
+    }
+    else if (command.actionLetter == ACTION_MOVE)
+    {
+        if (!getRobotLocation(command.robotLetter, row, col))
+            return false;
+        if (command.directionLetter == DIRECTION_EAST)
+            col += command.moveSteps;
+        else if (command.directionLetter == DIRECTION_WEST)
+            col -= command.moveSteps;
+        else if (command.directionLetter == DIRECTION_SOUTH)
+            row += command.moveSteps;
+        else if (command.directionLetter == DIRECTION_NORTH)
+            row -= command.moveSteps;
+    }
+    else
+    {
+        return false;
+    }
+    return row >= 0 && row < mapRows && col >= 0 && col < mapCols;
+}
+
+// Keep the robot locations in step with the map after a command
+void Game::updateRobotLocationsAfter(const Command &command, const ActionResult &result,
+                                     const char displacedLetter)
+{
+    if (command.actionLetter == ACTION_MOVE || command.actionLetter == ACTION_MOVETO)
+    {
+        int row, col;
+        if (result.status != STATUS_ACTION_MOVE_SUCCESS || !getMoveDestination(command, row, col))
+            return;
+        if (displacedLetter >= 'A' && displacedLetter <= 'Z' && displacedLetter != command.robotLetter)
+            forgetRobotLocation(robotLetterToArrayIndex(displacedLetter), false); // the mover took the cell
+        int i = robotLetterToArrayIndex(command.robotLetter);
+        if (robotRows[i] != row || robotCols[i] != col)
+        {
+            forgetRobotLocation(i, true);
+            setRobotLocation(i, row, col);
+        }
+    }
+    else if (command.actionLetter == ACTION_HIT || command.actionLetter == ACTION_SHOOT)
+    {
+        if (result.status != STATUS_ACTION_WEAPON_SUCCESS || result.targetUpdatedHealthPoint != 0)
+            return;
+        forgetRobotLocation(robotLetterToArrayIndex(result.targetRobotLetter), true);
+    }
+}
+
+// Put a robot on a cell in the robot locations, the occupancy and its team's positions
+void Game::setRobotLocation(const int robotIndex, const int row, const int col)
+{
+    robotRows[robotIndex] = row;
+    robotCols[robotIndex] = col;
+    if (healthPoints[robotIndex] > 0)
+    {
+        teamBits[robotTeams[robotIndex]][row] |= 1u << col;
+        visibilityDirty[robotTeams[robotIndex]] = true;
+    }
+    changeCellOccupancy(row, col, true);
+}
+
+// Take a robot out of the robot locations and its team's positions; cellEmptied tells whether
+// its cell is now empty, rather than taken by another robot
+void Game::forgetRobotLocation(const int robotIndex, const bool cellEmptied)
+{
+    const int row = robotRows[robotIndex], col = robotCols[robotIndex];
+    if (row == ROBOT_NOT_ON_MAP)
+        return;
+    robotRows[robotIndex] = robotCols[robotIndex] = ROBOT_NOT_ON_MAP;
+    if (teamBits[robotTeams[robotIndex]][row] & (1u << col))
+    {
+        teamBits[robotTeams[robotIndex]][row] &= ~(1u << col);
+        visibilityDirty[robotTeams[robotIndex]] = true;
+    }
+    if (cellEmptied)
+        changeCellOccupancy(row, col, false);
+}
+
+// Update the occupancy of a cell and the distance fields, and mark the teams whose view it may change
+// Lines of sight stay within the radius, so a cell out of the radius of every robot of a team
+// is not on any of its lines
+void Game::changeCellOccupancy(const int row, const int col, const bool occupied)
+{
+    const uint32_t bit = 1u << col;
+    if (((occupiedBits[row] & bit) != 0) == occupied)
+        return;
+    occupiedBits[row] ^= bit;
+    updateDistanceFields(distanceFields, mapRows, mapCols, row, col, occupied);
+    for (int team = 0; team < MAX_NUM_TEAMS; team++)
+        if (!visibilityDirty[team] && (reachableBits[team][row] & bit))
+            visibilityDirty[team] = true;
+}
+
+// Works on all the robots of the team at once, one offset within the radius at a time: the
+// robots whose line to the offset is open are the ones with no occupied cell at the line's
+// intermediate cells, and shifting them by the offset gives the cells they see
+void Game::computeVisibility(const int team)
+{
+    const uint32_t colsMask = (mapCols >= 32) ? ~0u : ((1u << mapCols) - 1);
+    const uint32_t *sources = teamBits[team];
+    uint32_t *visible = visibleBits[team];
+    uint32_t *reachable = reachableBits[team];
+    uint32_t open[MAX_ROWS];
+    const int rowRadius = min(visibilityRadius, mapRows - 1), colRadius = min(visibilityRadius, mapCols - 1);
+    int r, rowOffset, colOffset, k, stepRow, stepCol;
+
+    for (r = 0; r < mapRows; r++)
+        visible[r] = reachable[r] = sources[r];
+
+    for (rowOffset = -rowRadius; rowOffset <= rowRadius; rowOffset++)
+        for (colOffset = -colRadius; colOffset <= colRadius; colOffset++)
+        {
+            if ((rowOffset == 0 && colOffset == 0) ||
+                rowOffset * rowOffset + colOffset * colOffset > visibilityRadius * visibilityRadius)
+                continue;
+            for (r = 0; r < mapRows; r++)
+                open[r] = sources[r];
+            for (k = 1; k < max(abs(rowOffset), abs(colOffset)); k++)
+            {
+                getLineOfSightCell(rowOffset, colOffset, k, stepRow, stepCol);
+                for (r = max(0, -stepRow); r < mapRows && r + stepRow < mapRows; r++)
+                    open[r] &= ~shiftRowBits(occupiedBits[r + stepRow], -stepCol);
+            }
+            for (r = max(0, -rowOffset); r < mapRows && r + rowOffset < mapRows; r++)
+            {
+                visible[r + rowOffset] |= shiftRowBits(open[r], colOffset) & colsMask;
+                reachable[r + rowOffset] |= shiftRowBits(sources[r], colOffset) & colsMask;
+            }
+        }
+    visibilityDirty[team] = false;
+}
+
+const uint32_t *Game::getVisibleCells(const int team)
+{
+    if (visibilityDirty[team])
+        computeVisibility(team);
+    return visibleBits[team];
+}
+
+bool Game::isCellVisible(const int team, const int row, const int col)
+{
+    return (getVisibleCells(team)[row] >> col) & 1u;
+}
+
+void Game::getVisibleMap(const int team, char visibleMap[MAX_ROWS][MAX_COLS])
+{
+    const uint32_t *visible = getVisibleCells(team);
+    int r, c;
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            visibleMap[r][c] = ((visible[r] >> c) & 1u) ? map[r][c] : CHAR_HIDDEN;
+}
+
+void Game::markVisibleRobots(const int team, bool visibleRobots[MAX_NUM_ROBOTS])
+{
+    const uint32_t *visible = getVisibleCells(team);
+    int i;
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+        if (robotRows[i] != ROBOT_NOT_ON_MAP && ((visible[robotRows[i]] >> robotCols[i]) & 1u))
+            visibleRobots[i] = true;
+}
+
+void Game::setVisibilityRadius(const int radius)
+{
+    visibilityRadius = radius;
+    for (int team = 0; team < MAX_NUM_TEAMS; team++)
+        visibilityDirty[team] = true;
+}
+
+// Update the team numbers for one damaged robot; attackerIndex is -1 for damage without an attacker
+void Game::damageRobot(const int robotIndex, const int originalHealthPoint, const int updatedHealthPoint,
+                       const int attackerIndex)
+{
+    if (originalHealthPoint <= 0)
+        return; // was not counted as alive
+    TeamStatistics &statistics = teamStatistics[robotTeams[robotIndex]];
+    statistics.totalHealthPoints -= originalHealthPoint - updatedHealthPoint;
+    if (updatedHealthPoint > 0)
+        return;
+
+    statistics.aliveCount--;
+    if (statistics.aliveCount == 0)
+    {
+        numTeamsAlive--;
+        aliveTeamsSum -= robotTeams[robotIndex];
+    }
+    if (attackerIndex >= 0 && attackerIndex < MAX_NUM_ROBOTS)
+        teamStatistics[robotTeams[attackerIndex]].kills++;
+}
+
+int Game::getWinningTeam() const
+{
+    return (numTeamsAlive == 1) ? aliveTeamsSum : TEAM_NONE;
+}
+
+bool Game::getRobotLocation(const char robotLetter, int &row, int &col) const
+{
+    int i = robotLetterToArrayIndex(robotLetter);
+    if (i < 0 || i >= MAX_NUM_ROBOTS || robotRows[i] == ROBOT_NOT_ON_MAP)
+        return false;
+    row = robotRows[i];
+    col = robotCols[i];
+    return true;
+}
+
+int Game::applyHealthPointsEffect(const int change, char destroyedRobotLetters[MAX_NUM_ROBOTS])
+{
+    int destroyedIndices[MAX_NUM_ROBOTS], destroyedHealthPoints[MAX_NUM_ROBOTS];
+    int numDestroyed = ::applyHealthPointsEffect(healthPoints, MAX_NUM_ROBOTS, change,
+                                                 destroyedIndices, destroyedHealthPoints);
+    int k, team;
+
+    // The destroyed robots dropped to 0, every surviving alive robot changed by the same amount
+    for (k = 0; k < numDestroyed; k++)
+        damageRobot(destroyedIndices[k], destroyedHealthPoints[k], 0, -1);
+    for (team = 0; team < MAX_NUM_TEAMS; team++)
+        teamStatistics[team].totalHealthPoints += change * teamStatistics[team].aliveCount;
+
+    // Only the destroyed robots' cells change
+    for (k = 0; k < numDestroyed; k++)
+    {
+        int i = destroyedIndices[k];
+        if (robotRows[i] != ROBOT_NOT_ON_MAP)
+            map[robotRows[i]][robotCols[i]] = CHAR_EMPTY;
+        forgetRobotLocation(i, true);
+        destroyedRobotLetters[k] = arrayIndexToRobotLetter(i);
+    }
+    return numDestroyed;
+}
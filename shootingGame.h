@@ -0,0 +1,280 @@
+#ifndef SHOOTING_GAME_H
+#define SHOOTING_GAME_H
+
+// The game engine: the map, the robots' health points and the actions on them.
+// Embed it through the Game class below (or shootingGameC.h from C); the command-line game in
+// shootingGameProject.cpp, with its text input and output in shootingGameConsole.cpp, is a thin
+// front end on top of it.
+
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+
+const int MAX_ROWS = 20;
+const int MAX_COLS = 30;
+const int MAX_NUM_ROBOTS = 26;                // Note: Robots are named from A..Z
+const int ROBOT_NOT_ON_MAP = -1;              // location of a robot that is not on the map
+const int MAX_NUM_TEAMS = MAX_NUM_ROBOTS;     // Note: Teams are numbered from 0, robots without a team are on team 0
+const int TEAM_NONE = -1;
+const char CHAR_EMPTY = '.';
+const char CHAR_HIDDEN = '?'; // a cell the team cannot see
+const char CHAR_WALL = '#';   // blocks moves and shots, and cannot be damaged
+const char DIRECTION_EAST = 'e';
+const char DIRECTION_WEST = 'w';
+const char DIRECTION_SOUTH = 's';
+const char DIRECTION_NORTH = 'n';
+const char DIRECTION_ERROR = '!';
+const char ACTION_MOVE = 'm';
+const char ACTION_HIT = 'h';
+const char ACTION_SHOOT = 's';
+const char ACTION_ERROR = '!';
+const char ACTION_MOVETO = 't';
+const int STATUS_ACTION_MOVE_NOT_IMPLMENTED = 0;
+const int STATUS_ACTION_MOVE_SUCCESS = 1;
+const int STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY = 2;
+const int STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH = 3;
+const int STATUS_ACTION_MOVE_NO_PATH = 4;
+const int STATUS_ACTION_MOVE_HIT_WALL_ALONG_PATH = 5;
+
+// Walls: for the hit, shoot and move actions
+// wallDistances[r][c][d] is the number of steps from cell (r, c) to the first wall in direction
+// d, or WALL_DISTANCE_NONE if there is none before the boundary. Walls never change, so the
+// table is computed once when the map is loaded and the actions cut their rays with it.
+const int NUM_DIRECTIONS = 4;
+const int DIRECTION_INDEX_EAST = 0;
+const int DIRECTION_INDEX_SOUTH = 1;
+const int DIRECTION_INDEX_WEST = 2;
+const int DIRECTION_INDEX_NORTH = 3;
+const int WALL_DISTANCE_NONE = INT_MAX;
+
+// Pathfinding: for the moveto action
+const int MAX_NUM_DISTANCE_FIELDS = 8; // number of target cells whose distance fields are cached
+const int DISTANCE_UNREACHABLE = -1; // an empty cell with no path to the target
+const int DISTANCE_BLOCKED = -2;     // an occupied cell
+
+// A cached distance field: the number of steps from every cell to the target cell
+// A field is repaired in place as cells change their occupancy, see updateDistanceFields
+struct DistanceField
+{
+    bool valid;
+    int targetRow, targetCol;
+    int lastUsed; // for evicting the least recently used field
+    int distance[MAX_ROWS][MAX_COLS];
+};
+
+// Weapon: for the hit action
+const int WEAPON_HIT_DAMAGE = 200;
+
+// Weapon: for the shoot action
+const int WEAPON_SHOOT_DAMAGE = 100;
+const int WEAPON_SHOOT_RANGE = 5;
+
+const int STATUS_ACTION_WEAPON_NOT_IMPLEMENTED = 0;
+const int STATUS_ACTION_WEAPON_SUCCESS = 1;
+const int STATUS_ACTION_WEAPON_FAIL = 2;
+const int STATUS_ACTION_WEAPON_MISS = 3; // the attack roll failed, see RandomEvents
+
+// Random events: for balance testing
+// Every random number is drawn from Philox (philoxRandom.h) keyed by the game seed, with the
+// turn (the tick, for behaviors) and the acting robot as the counter. Nothing is carried from one draw to the next, so a
+// game replays the same in every mode, on any number of threads or processes. An attack is only
+// rolled when the weapon has a target: a hit or shoot at nothing fails rather than misses.
+const int HIT_CHANCE_ALWAYS = 100; // percent
+struct RandomEvents
+{
+    uint64_t seed;
+    int hitChance;      // percent of hits and shoots that land
+    int damageVariance; // the damage of a hit or shoot varies by up to this percent either way
+};
+
+// A parsed command for Game::apply
+struct Command
+{
+    char robotLetter;
+    char actionLetter;        // ACTION_MOVE, ACTION_HIT, ACTION_SHOOT or ACTION_MOVETO
+    char directionLetter;     // for ACTION_MOVE, ACTION_HIT and ACTION_SHOOT
+    int moveSteps;            // for ACTION_MOVE
+    int targetRow, targetCol; // for ACTION_MOVETO
+};
+
+// The outcome of Game::apply
+// status is one of STATUS_ACTION_MOVE_* for moves and STATUS_ACTION_WEAPON_* for weapons;
+// the target fields are only set by a successful hit or shoot, pathSteps by a successful moveto
+struct ActionResult
+{
+    int status;
+    char targetRobotLetter;
+    int targetOriginalHealthPoint;
+    int targetUpdatedHealthPoint;
+    int pathSteps;
+};
+
+// Visibility: for the fog of war
+// Robots see every cell within VISIBILITY_RADIUS cells (straight-line distance) whose line of
+// sight, see getLineOfSightCell, has no occupied cell before it; the first occupied cell on a
+// line is still visible. Every map row is one bit-packed word.
+const int VISIBILITY_RADIUS = WEAPON_SHOOT_RANGE;
+static_assert(MAX_COLS <= 32, "a map row must fit in one uint32_t");
+
+// Incrementally maintained numbers of one team
+// Alive robots are the ones with health points above 0, as in displayHealthPoints
+struct TeamStatistics
+{
+    int aliveCount;
+    int totalHealthPoints; // of the alive robots
+    int kills;             // robots destroyed by this team's hits and shoots
+};
+
+// Helper functions
+int robotLetterToArrayIndex(const char robotLetter);
+char arrayIndexToRobotLetter(const int index);
+int directionLetterToIndex(const char directionLetter);
+void initializeMap(char map[MAX_ROWS][MAX_COLS], const int numRows, const int numCols);
+bool isMapCellValid(const char cell);
+void initializeHealthPoints(int healthPoints[MAX_NUM_ROBOTS]);
+bool findRobotLocation(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                       const char robotLetter, int &robotRow, int &robotCol);
+void computeWallDistances(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                          int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS]);
+void getLineOfSightCell(const int rowOffset, const int colOffset, const int step, int &row, int &col);
+
+// Actions
+int updateHealthPointsForHitAction(int healthPoints[MAX_NUM_ROBOTS],
+                                   char map[MAX_ROWS][MAX_COLS],
+                                   const int mapRows, const int mapCols,
+                                   const int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS],
+                                   const char robotLetter,
+                                   const char directionLetter,
+                                   char &targetRobotLetter,
+                                   int &targetOriginalHealthPoint,
+                                   int &targetUpdatedHealthPoint,
+                                   const int damage = WEAPON_HIT_DAMAGE);
+int updateHealthPointsForShootAction(int healthPoints[MAX_NUM_ROBOTS],
+                                     char map[MAX_ROWS][MAX_COLS],
+                                     const int mapRows, const int mapCols,
+                                     const int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS],
+                                     const char robotLetter,
+                                     const char directionLetter,
+                                     char &targetRobotLetter,
+                                     int &targetOriginalHealthPoint,
+                                     int &targetUpdatedHealthPoint,
+                                     const int damage = WEAPON_SHOOT_DAMAGE);
+int updateMapForMoveAction(char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                           const int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS],
+                           const char robotLetter, const char directionLetter, const int moveSteps);
+int updateMapForMoveToAction(char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                             DistanceField distanceFields[MAX_NUM_DISTANCE_FIELDS], int &distanceFieldClock,
+                             int &numDistanceFieldSearches, const char robotLetter,
+                             const int targetRow, const int targetCol, int &pathSteps);
+
+// Random events
+void initializeRandomEvents(RandomEvents &events);
+bool rollWeaponAttack(const RandomEvents &events, const int turn, const int robotIndex,
+                      const int baseDamage, int &damage);
+
+// Global health point effects, e.g. poison or regeneration
+int applyHealthPointsEffect(int healthPoints[], const int numRobots, const int change,
+                            int destroyedIndices[], int destroyedHealthPoints[]);
+
+// Pathfinding
+void initializeDistanceFields(DistanceField distanceFields[MAX_NUM_DISTANCE_FIELDS]);
+void computeDistanceField(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                          DistanceField &field);
+void blockDistanceFieldCell(DistanceField &field, const int mapRows, const int mapCols, const int row, const int col);
+void openDistanceFieldCell(DistanceField &field, const int mapRows, const int mapCols, const int row, const int col);
+void updateDistanceFields(DistanceField distanceFields[MAX_NUM_DISTANCE_FIELDS], const int mapRows,
+                          const int mapCols, const int row, const int col, const bool occupied);
+DistanceField &lookupDistanceField(DistanceField distanceFields[MAX_NUM_DISTANCE_FIELDS],
+                                   const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                                   const int targetRow, const int targetCol, int &clock, int &numSearches);
+
+// The state of one game
+// Holds everything the actions work on, so several games can run side by side in one process
+class Game
+{
+public:
+    Game();
+
+    // Start a new game on a copy of the given map, health points and teams
+    // Without teams, every robot is on team 0. Returns false and leaves the game unchanged if the
+    // map does not fit in MAX_ROWS x MAX_COLS or has a cell that isMapCellValid rejects.
+    bool load(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+              const int healthPoints[MAX_NUM_ROBOTS], const int teams[MAX_NUM_ROBOTS] = NULL);
+
+    // Resolve one command and update the state; every command is one turn
+    ActionResult apply(const Command &command);
+
+    // Random events stay off (every attack lands for its full damage) until they are set
+    void setRandomEvents(const RandomEvents &events) { randomEvents = events; }
+    const RandomEvents &getRandomEvents() const { return randomEvents; }
+    // The turn keys the rolls along with the acting robot; apply counts it up by one, and a
+    // caller that plays in rounds, like the behavior scheduler, sets it to the round instead
+    int getTurn() const { return turn; }
+    void setTurn(const int turn) { this->turn = turn; }
+
+    // Change the health points of every alive robot by the same amount (negative for damage)
+    // and clear the cells of the robots it destroys; returns how many were destroyed and
+    // lists their letters in destroyedRobotLetters
+    int applyHealthPointsEffect(const int change, char destroyedRobotLetters[MAX_NUM_ROBOTS]);
+
+    int getMapRows() const { return mapRows; }
+    int getMapCols() const { return mapCols; }
+    char getCell(const int row, const int col) const { return map[row][col]; }
+    int getHealthPoint(const char robotLetter) const { return healthPoints[robotLetterToArrayIndex(robotLetter)]; }
+    const char (*getMap() const)[MAX_COLS] { return map; }
+    const int *getHealthPoints() const { return healthPoints; }
+    bool getRobotLocation(const char robotLetter, int &row, int &col) const;
+    // The distance fields moveto had to search from scratch rather than take from the cache
+    int getNumDistanceFieldSearches() const { return numDistanceFieldSearches; }
+
+    // Team queries, all in constant time
+    int getRobotTeam(const char robotLetter) const { return robotTeams[robotLetterToArrayIndex(robotLetter)]; }
+    const TeamStatistics &getTeamStatistics(const int team) const { return teamStatistics[team]; }
+    int getNumTeamsAlive() const { return numTeamsAlive; }
+    int getWinningTeam() const; // the only team with alive robots, or TEAM_NONE
+
+    // Visibility queries; a team's mask is only recomputed after a change it could see
+    void setVisibilityRadius(const int radius);
+    const uint32_t *getVisibleCells(const int team); // one word per row, bit c for column c
+    bool isCellVisible(const int team, const int row, const int col);
+    void getVisibleMap(const int team, char visibleMap[MAX_ROWS][MAX_COLS]); // CHAR_HIDDEN where not visible
+    // Set the entries of the robots on the map that the team can see now; the other entries are
+    // left alone, so marking before and after a command gives every robot the team saw during it
+    void markVisibleRobots(const int team, bool visibleRobots[MAX_NUM_ROBOTS]);
+
+private:
+    int applyWeaponAction(const Command &command, ActionResult &result);
+    int resolveWeaponAction(char stateMap[MAX_ROWS][MAX_COLS], int stateHealthPoints[MAX_NUM_ROBOTS],
+                            const Command &command, ActionResult &result, const int damage) const;
+    void damageRobot(const int robotIndex, const int originalHealthPoint, const int updatedHealthPoint,
+                     const int attackerIndex);
+    bool getMoveDestination(const Command &command, int &row, int &col) const;
+    void updateRobotLocationsAfter(const Command &command, const ActionResult &result, const char displacedLetter);
+    void setRobotLocation(const int robotIndex, const int row, const int col);
+    void forgetRobotLocation(const int robotIndex, const bool cellEmptied);
+    void changeCellOccupancy(const int row, const int col, const bool occupied);
+    void computeVisibility(const int team);
+
+    char map[MAX_ROWS][MAX_COLS];
+    int healthPoints[MAX_NUM_ROBOTS];
+    int mapRows, mapCols;
+    int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS];
+    DistanceField distanceFields[MAX_NUM_DISTANCE_FIELDS];
+    int distanceFieldClock;
+    int numDistanceFieldSearches;
+    int robotRows[MAX_NUM_ROBOTS], robotCols[MAX_NUM_ROBOTS];
+    int robotTeams[MAX_NUM_ROBOTS];
+    TeamStatistics teamStatistics[MAX_NUM_TEAMS];
+    int numTeamsAlive;
+    int aliveTeamsSum; // sum of the teams with alive robots: the winner when only one is left
+    uint32_t occupiedBits[MAX_ROWS];
+    uint32_t teamBits[MAX_NUM_TEAMS][MAX_ROWS]; // alive robots of each team on the map
+    uint32_t visibleBits[MAX_NUM_TEAMS][MAX_ROWS];
+    uint32_t reachableBits[MAX_NUM_TEAMS][MAX_ROWS]; // within the radius of the team's robots
+    bool visibilityDirty[MAX_NUM_TEAMS];
+    int visibilityRadius;
+    RandomEvents randomEvents;
+    int turn;
+};
+
+#endif
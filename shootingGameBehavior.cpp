@@ -0,0 +1,210 @@
+#include <exception>
+#include <new>
+#include "shootingGame.h"
+#include "shootingGameConsole.h"
+#include "shootingGameBehavior.h"
+
+// A pooled coroutine frame; a free frame holds the next free one
+// Every thread has its own free list, so schedulers on different threads never share it; a
+// frame freed on another thread than the one that took it joins that thread's list
+union BehaviorFrame
+{
+    BehaviorFrame *next;
+    alignas(std::max_align_t) unsigned char bytes[BEHAVIOR_FRAME_SIZE];
+};
+
+static thread_local BehaviorFrame *freeBehaviorFrames = nullptr;
+
+void *RobotBehavior::promise_type::operator new(size_t size)
+{
+    if (size > BEHAVIOR_FRAME_SIZE)
+        return ::operator new(size);
+    if (freeBehaviorFrames == nullptr)
+    {
+        // the chunks are kept for the next behaviors rather than given back
+        BehaviorFrame *chunk = new BehaviorFrame[BEHAVIOR_FRAMES_PER_CHUNK];
+        for (int i = 0; i < BEHAVIOR_FRAMES_PER_CHUNK; i++)
+        {
+            chunk[i].next = freeBehaviorFrames;
+            freeBehaviorFrames = &chunk[i];
+        }
+    }
+    BehaviorFrame *frame = freeBehaviorFrames;
+    freeBehaviorFrames = frame->next;
+    return frame;
+}
+
+void RobotBehavior::promise_type::operator delete(void *frame, size_t size)
+{
+    if (size > BEHAVIOR_FRAME_SIZE)
+    {
+        ::operator delete(frame);
+        return;
+    }
+    BehaviorFrame *freed = static_cast<BehaviorFrame *>(frame);
+    freed->next = freeBehaviorFrames;
+    freeBehaviorFrames = freed;
+}
+
+void RobotBehavior::promise_type::unhandled_exception()
+{
+    std::terminate();
+}
+
+RobotBehavior &RobotBehavior::operator=(RobotBehavior &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (handle)
+            handle.destroy();
+        handle = other.handle;
+        other.handle = nullptr;
+    }
+    return *this;
+}
+
+RobotBehavior::~RobotBehavior()
+{
+    if (handle)
+        handle.destroy();
+}
+
+bool RobotBehavior::resume()
+{
+    if (isDone())
+        return false;
+    handle.resume();
+    return !handle.done();
+}
+
+BehaviorScheduler::BehaviorScheduler(Game &game, const bool display, const int fogTeam)
+    : game(game), display(display), fogTeam(fogTeam), tickTurn(game.getTurn()), numBehaviors(0)
+{
+}
+
+int BehaviorScheduler::add(RobotBehavior behavior)
+{
+    if (numBehaviors == MAX_NUM_BEHAVIORS)
+        return STATUS_BEHAVIOR_TOO_MANY;
+    behaviors[numBehaviors++] = static_cast<RobotBehavior &&>(behavior);
+    return STATUS_BEHAVIOR_ADDED;
+}
+
+int BehaviorScheduler::runTick()
+{
+    int i, kept = 0;
+    for (i = 0; i < numBehaviors; i++)
+    {
+        // finished behaviors are dropped by moving the running ones down, keeping their order
+        if (behaviors[i].resume())
+        {
+            if (kept != i)
+                behaviors[kept] = static_cast<RobotBehavior &&>(behaviors[i]);
+            kept++;
+        }
+    }
+    for (i = kept; i < numBehaviors; i++)
+        behaviors[i] = RobotBehavior();
+    numBehaviors = kept;
+
+    // the commands after the tick, the next tick's or the ones played without behaviors, follow it
+    tickTurn++;
+    game.setTurn(tickTurn);
+    return numBehaviors;
+}
+
+ActionResult BehaviorScheduler::apply(const Command &command)
+{
+    bool visibleRobots[MAX_NUM_ROBOTS] = {false};
+    const bool fog = display && fogTeam != TEAM_NONE;
+    if (fog)
+        game.markVisibleRobots(fogTeam, visibleRobots);
+    game.setTurn(tickTurn);
+    ActionResult result = game.apply(command);
+    if (fog)
+    {
+        game.markVisibleRobots(fogTeam, visibleRobots);
+        game.getVisibleMap(fogTeam, visibleMap);
+        displayActionResult(command, result, visibleMap, game.getMapRows(), game.getMapCols(),
+                            game.getHealthPoints(), visibleRobots);
+    }
+    else if (display)
+    {
+        displayActionResult(command, result, game.getMap(), game.getMapRows(), game.getMapCols(),
+                            game.getHealthPoints());
+    }
+    return result;
+}
+
+// Helper function: whether a robot would shoot at what is in a cell
+bool isBehaviorTarget(Game &game, const char robotLetter, const char cell)
+{
+    int index = robotLetterToArrayIndex(cell);
+    if (cell == robotLetter || index < 0 || index >= MAX_NUM_ROBOTS)
+        return false;
+    const int team = game.getRobotTeam(robotLetter);
+    return team == 0 || game.getRobotTeam(cell) != team;
+}
+
+RobotBehavior patrolBehavior(BehaviorScheduler &scheduler, const char robotLetter)
+{
+    const char directions[4] = {DIRECTION_EAST, DIRECTION_SOUTH, DIRECTION_WEST, DIRECTION_NORTH};
+    const int rowSteps[4] = {0, 1, 0, -1};
+    const int colSteps[4] = {1, 0, -1, 0};
+    char patrolDirection = DIRECTION_EAST;
+    Command command;
+    int row, col, d, range;
+
+    if (robotLetterToArrayIndex(robotLetter) < 0 || robotLetterToArrayIndex(robotLetter) >= MAX_NUM_ROBOTS)
+        co_return;
+    command.robotLetter = robotLetter;
+    command.moveSteps = 1;
+    command.targetRow = command.targetCol = 0;
+    while (true)
+    {
+        Game &game = scheduler.getGame();
+        if (game.getHealthPoint(robotLetter) <= 0 || !game.getRobotLocation(robotLetter, row, col))
+            co_return;
+
+        // shoot on sight: the shot stops at the first robot or wall, so only that cell is considered
+        int targetDirection = -1;
+        for (d = 0; d < 4 && targetDirection < 0; d++)
+        {
+            for (range = 1; range <= WEAPON_SHOOT_RANGE; range++)
+            {
+                const int r = row + rowSteps[d] * range, c = col + colSteps[d] * range;
+                if (r < 0 || r >= game.getMapRows() || c < 0 || c >= game.getMapCols())
+                    break;
+                if (game.getCell(r, c) == CHAR_EMPTY)
+                    continue;
+                if (isBehaviorTarget(game, robotLetter, game.getCell(r, c)))
+                    targetDirection = d;
+                break;
+            }
+        }
+
+        if (targetDirection >= 0)
+        {
+            command.actionLetter = ACTION_SHOOT;
+            command.directionLetter = directions[targetDirection];
+            scheduler.apply(command);
+        }
+        else
+        {
+            // patrol: step along the row, turning around when the next cell is taken or off the map
+            int nextCol = col + (patrolDirection == DIRECTION_EAST ? 1 : -1);
+            if (nextCol < 0 || nextCol >= game.getMapCols() || game.getCell(row, nextCol) != CHAR_EMPTY)
+            {
+                patrolDirection = (patrolDirection == DIRECTION_EAST ? DIRECTION_WEST : DIRECTION_EAST);
+                nextCol = col + (patrolDirection == DIRECTION_EAST ? 1 : -1);
+            }
+            if (nextCol >= 0 && nextCol < game.getMapCols() && game.getCell(row, nextCol) == CHAR_EMPTY)
+            {
+                command.actionLetter = ACTION_MOVE;
+                command.directionLetter = patrolDirection;
+                scheduler.apply(command);
+            }
+        }
+        co_await nextTurn();
+    }
+}
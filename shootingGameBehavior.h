@@ -0,0 +1,102 @@
+#ifndef SHOOTING_GAME_BEHAVIOR_H
+#define SHOOTING_GAME_BEHAVIOR_H
+
+// Scripted robot behaviors: for the --behavior option
+// A behavior is a C++20 coroutine that acts for one robot and waits for the next turn with
+// co_await nextTurn(); the scheduler resumes every behavior once per tick. Needs -std=c++20, as
+// does every file including this header, the command-line game among them (see CMakeLists.txt).
+
+#include <coroutine>
+#include <cstddef>
+#include "shootingGame.h"
+
+const int MAX_NUM_BEHAVIORS = 4096;
+const int BEHAVIOR_DEFAULT_TICKS = 100;
+const size_t BEHAVIOR_FRAME_SIZE = 256;     // frames up to this size come from the pool
+const int BEHAVIOR_FRAMES_PER_CHUNK = 256;  // the pool grows by this many frames at a time
+const int STATUS_BEHAVIOR_ADDED = 0;
+const int STATUS_BEHAVIOR_TOO_MANY = 1;
+
+// A running behavior; owns its coroutine frame
+class RobotBehavior
+{
+public:
+    struct promise_type
+    {
+        RobotBehavior get_return_object() { return RobotBehavior(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception();
+
+        // The frames come from a free list of the calling thread instead of the heap
+        static void *operator new(size_t size);
+        static void operator delete(void *frame, size_t size);
+    };
+
+    RobotBehavior() : handle(nullptr) {}
+    RobotBehavior(RobotBehavior &&other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    RobotBehavior &operator=(RobotBehavior &&other) noexcept;
+    RobotBehavior(const RobotBehavior &) = delete;
+    RobotBehavior &operator=(const RobotBehavior &) = delete;
+    ~RobotBehavior();
+
+    // Run the behavior up to its next co_await; returns false once it has finished
+    bool resume();
+    bool isDone() const { return handle == nullptr || handle.done(); }
+
+private:
+    explicit RobotBehavior(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// What a behavior awaits to give the turn to the other robots
+struct NextTurn
+{
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<>) const noexcept {}
+    void await_resume() const noexcept {}
+};
+
+inline NextTurn nextTurn() { return NextTurn(); }
+
+// Resumes the behaviors of one game in turns
+class BehaviorScheduler
+{
+public:
+    // With display, every command is printed as in the command-line game; with a fog team, the
+    // output only shows what it can see
+    BehaviorScheduler(Game &game, const bool display, const int fogTeam = TEAM_NONE);
+
+    int add(RobotBehavior behavior);
+
+    // Resume every behavior once, in the order they were added; finished behaviors are dropped.
+    // Returns how many are still running
+    int runTick();
+
+    // Resolve a command for a behavior in the current tick
+    // Every command of a tick is resolved in the same game turn, so a robot's random rolls depend
+    // only on the seed, the tick and the robot, whichever other behaviors run and in what order
+    ActionResult apply(const Command &command);
+
+    Game &getGame() { return game; }
+    int getNumBehaviors() const { return numBehaviors; }
+
+private:
+    Game &game;
+    bool display;
+    int fogTeam;
+    int tickTurn; // the game turn of the current tick; the ticks follow the turns played before
+    char visibleMap[MAX_ROWS][MAX_COLS];
+    RobotBehavior behaviors[MAX_NUM_BEHAVIORS];
+    int numBehaviors;
+};
+
+// Behaviors
+// Walk east and west along the row, turning at walls, robots and boundaries, and shoot the
+// first robot seen within range in any direction unless it is a teammate; robots on team 0,
+// the team of every robot in games without teams, shoot anyone. Stops when destroyed
+RobotBehavior patrolBehavior(BehaviorScheduler &scheduler, const char robotLetter);
+
+#endif
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <thread>
+#include "shootingGame.h"
+#include "shootingGameBehavior.h"
+using namespace std;
+
+// Checks the behavior scheduler: the random rolls of a behavior's robot depend only on the seed,
+// the tick and the robot, not on which other behaviors run or in what order, and schedulers on
+// different threads do not share their coroutine frames
+// Usage: shootingGameBehaviorTest    prints the first failed check and returns 1, or returns 0
+const int BEHAVIOR_TEST_TICKS = 200;
+
+// Helper function: play patrol behaviors for the robots in order on two pairs of robots that
+// never see each other, with random events on
+void runBehaviorTestGame(Game &game, const char robotLetters[], const int numRobots)
+{
+    char map[MAX_ROWS][MAX_COLS];
+    int healthPoints[MAX_NUM_ROBOTS];
+    RandomEvents events;
+    int i;
+
+    initializeMap(map, MAX_ROWS, MAX_COLS);
+    initializeHealthPoints(healthPoints);
+    map[0][0] = 'A';
+    map[0][3] = 'B';
+    map[10][20] = 'C';
+    map[10][23] = 'D';
+    for (i = 0; i < 4; i++)
+        healthPoints[i] = 5000;
+    game.load(map, MAX_ROWS, MAX_COLS, healthPoints);
+    initializeRandomEvents(events);
+    events.seed = 11;
+    events.hitChance = 50;
+    events.damageVariance = 30;
+    game.setRandomEvents(events);
+
+    // the scheduler holds a slot for every possible behavior, too large for the stack
+    BehaviorScheduler *scheduler = new BehaviorScheduler(game, false);
+    for (i = 0; i < numRobots; i++)
+        scheduler->add(patrolBehavior(*scheduler, robotLetters[i]));
+    for (i = 0; i < BEHAVIOR_TEST_TICKS; i++)
+        scheduler->runTick();
+    delete scheduler;
+}
+
+// Helper function: whether a robot ends with the same health points and on the same cell in two games
+bool isRobotStateSame(const Game &game, const Game &other, const char robotLetter)
+{
+    int row, col, otherRow, otherCol;
+    bool found = game.getRobotLocation(robotLetter, row, col);
+    bool otherFound = other.getRobotLocation(robotLetter, otherRow, otherCol);
+    return game.getHealthPoint(robotLetter) == other.getHealthPoint(robotLetter) && found == otherFound &&
+           (!found || (row == otherRow && col == otherCol));
+}
+
+int main()
+{
+    const char allRobots[4] = {'A', 'B', 'C', 'D'};
+    const char reorderedRobots[4] = {'C', 'D', 'A', 'B'};
+    const char pairRobots[2] = {'A', 'B'};
+    Game game, reordered, pair, threaded, otherThreaded;
+    char robotLetter;
+
+    runBehaviorTestGame(game, allRobots, 4);
+    runBehaviorTestGame(reordered, reorderedRobots, 4);
+    runBehaviorTestGame(pair, pairRobots, 2);
+
+    // two schedulers at once, as two embedded games on their own threads would run them
+    thread first(runBehaviorTestGame, ref(threaded), allRobots, 4);
+    thread second(runBehaviorTestGame, ref(otherThreaded), reorderedRobots, 4);
+    first.join();
+    second.join();
+
+    if (game.getHealthPoint('A') == 5000 || game.getHealthPoint('C') == 5000)
+    {
+        cout << "Fail: the behaviors did not fight" << endl;
+        return 1;
+    }
+    for (robotLetter = 'A'; robotLetter <= 'D'; robotLetter++)
+        if (!isRobotStateSame(game, reordered, robotLetter))
+        {
+            cout << "Fail: robot " << robotLetter << " plays out differently when the behaviors are reordered" << endl;
+            return 1;
+        }
+    for (robotLetter = 'A'; robotLetter <= 'B'; robotLetter++)
+        if (!isRobotStateSame(game, pair, robotLetter))
+        {
+            cout << "Fail: robot " << robotLetter << " plays out differently when other behaviors are dropped" << endl;
+            return 1;
+        }
+    for (robotLetter = 'A'; robotLetter <= 'D'; robotLetter++)
+        if (!isRobotStateSame(game, threaded, robotLetter) || !isRobotStateSame(game, otherThreaded, robotLetter))
+        {
+            cout << "Fail: robot " << robotLetter << " plays out differently when two schedulers run on two threads" << endl;
+            return 1;
+        }
+
+    cout << "Success: the behaviors' rolls depend only on the seed, the tick and the robot, on any thread" << endl;
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <cstddef>
+#include <new>
+#include "shootingGame.h"
+#include "shootingGameC.h"
+
+// Keep the C constants in step with the engine
+static_assert(SHOOTING_GAME_MAX_ROWS == MAX_ROWS && SHOOTING_GAME_MAX_COLS == MAX_COLS, "map size");
+static_assert(SHOOTING_GAME_MAX_NUM_ROBOTS == MAX_NUM_ROBOTS, "number of robots");
+static_assert(SHOOTING_GAME_MAX_NUM_TEAMS == MAX_NUM_TEAMS && SHOOTING_GAME_TEAM_NONE == TEAM_NONE, "teams");
+static_assert(SHOOTING_GAME_CELL_EMPTY == CHAR_EMPTY && SHOOTING_GAME_CELL_WALL == CHAR_WALL, "map cells");
+static_assert(SHOOTING_GAME_ACTION_MOVETO == ACTION_MOVETO, "moveto action letter");
+static_assert(SHOOTING_GAME_STATUS_MOVE_NO_PATH == STATUS_ACTION_MOVE_NO_PATH, "move status");
+static_assert(SHOOTING_GAME_STATUS_MOVE_HIT_WALL_ALONG_PATH == STATUS_ACTION_MOVE_HIT_WALL_ALONG_PATH, "move status");
+static_assert(SHOOTING_GAME_STATUS_WEAPON_FAIL == STATUS_ACTION_WEAPON_FAIL, "weapon status");
+static_assert(SHOOTING_GAME_STATUS_WEAPON_MISS == STATUS_ACTION_WEAPON_MISS, "weapon status");
+static_assert(SHOOTING_GAME_MAX_MOVE_STEPS == (MAX_ROWS > MAX_COLS ? MAX_ROWS : MAX_COLS), "move steps");
+
+// Helper function: whether a letter names a robot, so it can index the engine's arrays
+bool isShootingGameRobotLetter(const char robotLetter)
+{
+    int index = robotLetterToArrayIndex(robotLetter);
+    return index >= 0 && index < MAX_NUM_ROBOTS;
+}
+
+struct ShootingGame
+{
+    Game game;
+};
+
+ShootingGame *shootingGameCreate(const char *mapCells, int mapRows, int mapCols,
+                                 const int healthPoints[SHOOTING_GAME_MAX_NUM_ROBOTS])
+{
+    return shootingGameCreateWithTeams(mapCells, mapRows, mapCols, healthPoints, NULL);
+}
+
+ShootingGame *shootingGameCreateWithTeams(const char *mapCells, int mapRows, int mapCols,
+                                          const int healthPoints[SHOOTING_GAME_MAX_NUM_ROBOTS],
+                                          const int teams[SHOOTING_GAME_MAX_NUM_ROBOTS])
+{
+    char map[MAX_ROWS][MAX_COLS];
+    int r, c;
+
+    if (mapCells == NULL || healthPoints == NULL)
+        return NULL;
+    if (mapRows < 1 || mapRows > MAX_ROWS || mapCols < 1 || mapCols > MAX_COLS)
+        return NULL;
+
+    ShootingGame *game = new (std::nothrow) ShootingGame;
+    if (game == NULL)
+        return NULL;
+
+    initializeMap(map, MAX_ROWS, MAX_COLS);
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            map[r][c] = mapCells[r * mapCols + c];
+    if (!game->game.load(map, mapRows, mapCols, healthPoints, teams))
+    {
+        delete game;
+        return NULL;
+    }
+    return game;
+}
+
+void shootingGameDestroy(ShootingGame *game)
+{
+    delete game;
+}
+
+int shootingGameApply(ShootingGame *game, const ShootingGameCommand *command, ShootingGameResult *result)
+{
+    Command engineCommand;
+    // the move actions walk every step before checking the boundary, so the steps are capped
+    if (!isShootingGameRobotLetter(command->robotLetter) || command->moveSteps < 0 ||
+        command->moveSteps > SHOOTING_GAME_MAX_MOVE_STEPS)
+    {
+        if (result != NULL)
+        {
+            result->status = SHOOTING_GAME_STATUS_INVALID_ARGUMENT;
+            result->targetRobotLetter = CHAR_EMPTY;
+            result->targetOriginalHealthPoint = result->targetUpdatedHealthPoint = 0;
+            result->pathSteps = 0;
+        }
+        return SHOOTING_GAME_STATUS_INVALID_ARGUMENT;
+    }
+
+    engineCommand.robotLetter = command->robotLetter;
+    engineCommand.actionLetter = command->actionLetter;
+    engineCommand.directionLetter = command->directionLetter;
+    engineCommand.moveSteps = command->moveSteps;
+    engineCommand.targetRow = command->targetRow;
+    engineCommand.targetCol = command->targetCol;
+
+    ActionResult engineResult = game->game.apply(engineCommand);
+    if (result != NULL)
+    {
+        result->status = engineResult.status;
+        result->targetRobotLetter = engineResult.targetRobotLetter;
+        result->targetOriginalHealthPoint = engineResult.targetOriginalHealthPoint;
+        result->targetUpdatedHealthPoint = engineResult.targetUpdatedHealthPoint;
+        result->pathSteps = engineResult.pathSteps;
+    }
+    return engineResult.status;
+}
+
+int shootingGameApplyHealthPointsEffect(ShootingGame *game, int change,
+                                        char destroyedRobotLetters[SHOOTING_GAME_MAX_NUM_ROBOTS])
+{
+    return game->game.applyHealthPointsEffect(change, destroyedRobotLetters);
+}
+
+void shootingGameSetRandomEvents(ShootingGame *game, unsigned long long seed, int hitChance, int damageVariance)
+{
+    RandomEvents events;
+    events.seed = seed;
+    events.hitChance = hitChance;
+    events.damageVariance = damageVariance;
+    game->game.setRandomEvents(events);
+}
+
+int shootingGameGetMapRows(const ShootingGame *game)
+{
+    return game->game.getMapRows();
+}
+
+int shootingGameGetMapCols(const ShootingGame *game)
+{
+    return game->game.getMapCols();
+}
+
+char shootingGameGetCell(const ShootingGame *game, int row, int col)
+{
+    if (row < 0 || row >= game->game.getMapRows() || col < 0 || col >= game->game.getMapCols())
+        return SHOOTING_GAME_CELL_NONE;
+    return game->game.getCell(row, col);
+}
+
+int shootingGameGetHealthPoint(const ShootingGame *game, char robotLetter)
+{
+    if (!isShootingGameRobotLetter(robotLetter))
+        return SHOOTING_GAME_HEALTH_POINT_NONE;
+    return game->game.getHealthPoint(robotLetter);
+}
+
+int shootingGameGetTeamStatistics(const ShootingGame *game, int team, ShootingGameTeamStatistics *statistics)
+{
+    if (team < 0 || team >= MAX_NUM_TEAMS)
+        return SHOOTING_GAME_TEAM_NONE;
+    const TeamStatistics &engineStatistics = game->game.getTeamStatistics(team);
+    statistics->aliveCount = engineStatistics.aliveCount;
+    statistics->totalHealthPoints = engineStatistics.totalHealthPoints;
+    statistics->kills = engineStatistics.kills;
+    return team;
+}
+
+int shootingGameGetWinningTeam(const ShootingGame *game)
+{
+    return game->game.getWinningTeam();
+}
@@ -0,0 +1,122 @@
+#ifndef SHOOTING_GAME_C_H
+#define SHOOTING_GAME_C_H
+
+/* C interface to the game engine in shootingGame.h
+ * The letters and status codes have the same values as the constants there. */
+
+#include <limits.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define SHOOTING_GAME_MAX_ROWS 20
+#define SHOOTING_GAME_MAX_COLS 30
+#define SHOOTING_GAME_MAX_NUM_ROBOTS 26 /* robots are named from A..Z */
+#define SHOOTING_GAME_MAX_NUM_TEAMS 26  /* teams are numbered from 0 */
+#define SHOOTING_GAME_TEAM_NONE (-1)
+#define SHOOTING_GAME_MAX_MOVE_STEPS 30 /* the longer side of the largest map */
+
+/* Map cells other than the robot letters */
+#define SHOOTING_GAME_CELL_EMPTY '.'
+#define SHOOTING_GAME_CELL_WALL '#'
+
+/* Actions and directions */
+#define SHOOTING_GAME_ACTION_MOVE 'm'
+#define SHOOTING_GAME_ACTION_HIT 'h'
+#define SHOOTING_GAME_ACTION_SHOOT 's'
+#define SHOOTING_GAME_ACTION_MOVETO 't'
+#define SHOOTING_GAME_DIRECTION_EAST 'e'
+#define SHOOTING_GAME_DIRECTION_WEST 'w'
+#define SHOOTING_GAME_DIRECTION_SOUTH 's'
+#define SHOOTING_GAME_DIRECTION_NORTH 'n'
+
+/* Statuses of the move and moveto actions */
+#define SHOOTING_GAME_STATUS_MOVE_NOT_IMPLEMENTED 0
+#define SHOOTING_GAME_STATUS_MOVE_SUCCESS 1
+#define SHOOTING_GAME_STATUS_MOVE_OUTSIDE_BOUNDARY 2
+#define SHOOTING_GAME_STATUS_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH 3
+#define SHOOTING_GAME_STATUS_MOVE_NO_PATH 4
+#define SHOOTING_GAME_STATUS_MOVE_HIT_WALL_ALONG_PATH 5
+
+/* Returned for arguments outside the game: an unknown robot, a cell off the map, a team out of range */
+#define SHOOTING_GAME_STATUS_INVALID_ARGUMENT (-1)
+#define SHOOTING_GAME_CELL_NONE '\0'
+#define SHOOTING_GAME_HEALTH_POINT_NONE INT_MIN
+
+/* Statuses of the hit and shoot actions */
+#define SHOOTING_GAME_STATUS_WEAPON_NOT_IMPLEMENTED 0
+#define SHOOTING_GAME_STATUS_WEAPON_SUCCESS 1
+#define SHOOTING_GAME_STATUS_WEAPON_FAIL 2
+#define SHOOTING_GAME_STATUS_WEAPON_MISS 3
+
+typedef struct ShootingGame ShootingGame; /* opaque, owned by the library */
+
+typedef struct
+{
+    char robotLetter;
+    char actionLetter;
+    char directionLetter;     /* for move, hit and shoot */
+    int moveSteps;            /* for move */
+    int targetRow, targetCol; /* for moveto */
+} ShootingGameCommand;
+
+typedef struct
+{
+    int aliveCount;
+    int totalHealthPoints;
+    int kills;
+} ShootingGameTeamStatistics;
+
+typedef struct
+{
+    int status;
+    char targetRobotLetter;
+    int targetOriginalHealthPoint;
+    int targetUpdatedHealthPoint;
+    int pathSteps;
+} ShootingGameResult;
+
+/* Create a game; mapCells holds mapRows * mapCols cells row by row, healthPoints is indexed
+ * by robot letter ('A' => 0). Returns NULL if the map does not fit or has a cell that is not
+ * SHOOTING_GAME_CELL_EMPTY, SHOOTING_GAME_CELL_WALL or a robot letter A..Z. */
+ShootingGame *shootingGameCreate(const char *mapCells, int mapRows, int mapCols,
+                                 const int healthPoints[SHOOTING_GAME_MAX_NUM_ROBOTS]);
+/* Same, with the team of every robot (indexed like healthPoints); NULL puts everyone on team 0 */
+ShootingGame *shootingGameCreateWithTeams(const char *mapCells, int mapRows, int mapCols,
+                                          const int healthPoints[SHOOTING_GAME_MAX_NUM_ROBOTS],
+                                          const int teams[SHOOTING_GAME_MAX_NUM_ROBOTS]);
+void shootingGameDestroy(ShootingGame *game);
+
+/* Resolve one command; returns the status, and fills result if it is not NULL
+ * A robot letter outside A..Z or move steps outside 0..SHOOTING_GAME_MAX_MOVE_STEPS give
+ * SHOOTING_GAME_STATUS_INVALID_ARGUMENT and leave the game unchanged. */
+int shootingGameApply(ShootingGame *game, const ShootingGameCommand *command, ShootingGameResult *result);
+
+/* Change the health points of every alive robot by change (negative for damage); destroyed
+ * robots are removed from the map and their letters written to destroyedRobotLetters.
+ * Returns how many robots were destroyed. */
+int shootingGameApplyHealthPointsEffect(ShootingGame *game, int change,
+                                        char destroyedRobotLetters[SHOOTING_GAME_MAX_NUM_ROBOTS]);
+
+/* Turn on random events: hitChance percent of the hits and shoots land, and their damage varies
+ * by up to damageVariance percent either way. The rolls depend only on the seed, the turn and
+ * the robot, so games with the same seed and commands play out the same. */
+void shootingGameSetRandomEvents(ShootingGame *game, unsigned long long seed, int hitChance, int damageVariance);
+
+int shootingGameGetMapRows(const ShootingGame *game);
+int shootingGameGetMapCols(const ShootingGame *game);
+/* SHOOTING_GAME_CELL_NONE for a cell off the map */
+char shootingGameGetCell(const ShootingGame *game, int row, int col);
+/* SHOOTING_GAME_HEALTH_POINT_NONE for a robot letter outside A..Z */
+int shootingGameGetHealthPoint(const ShootingGame *game, char robotLetter);
+/* Returns the team, or SHOOTING_GAME_TEAM_NONE without touching statistics for a team out of range */
+int shootingGameGetTeamStatistics(const ShootingGame *game, int team, ShootingGameTeamStatistics *statistics);
+int shootingGameGetWinningTeam(const ShootingGame *game); /* SHOOTING_GAME_TEAM_NONE if none */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stddef.h>
+#include "shootingGameC.h"
+
+/* Checks that the C interface turns away the arguments that would take the engine outside its
+ * arrays, and still resolves the commands next to them.
+ * Usage: shootingGameCTest    prints the first failed check and returns 1, or returns 0 */
+
+/* Helper function: print a failed check */
+int failCheck(const char *check)
+{
+    printf("Fail: %s\n", check);
+    return 1;
+}
+
+int main(void)
+{
+    int healthPoints[SHOOTING_GAME_MAX_NUM_ROBOTS] = {100, 100};
+    ShootingGameCommand command = {'A', SHOOTING_GAME_ACTION_MOVE, SHOOTING_GAME_DIRECTION_EAST, 0, 0, 0};
+    ShootingGameResult result;
+    ShootingGame *game;
+
+    /* maps the engine cannot hold */
+    if (shootingGameCreate("Ax...", 1, 5, healthPoints) != NULL)
+        return failCheck("a map with a cell that is not empty, a wall or a robot is created");
+    if (shootingGameCreate("A\0...", 1, 5, healthPoints) != NULL)
+        return failCheck("a map with a null cell is created");
+    if (shootingGameCreate("A....", 0, 5, healthPoints) != NULL)
+        return failCheck("a map without rows is created");
+    if (shootingGameCreate(NULL, 1, 5, healthPoints) != NULL || shootingGameCreate("A....", 1, 5, NULL) != NULL)
+        return failCheck("a game is created from a null pointer");
+
+    game = shootingGameCreate("A.#.B", 1, 5, healthPoints);
+    if (game == NULL)
+        return failCheck("a map of empty cells, walls and robots is not created");
+
+    /* commands the engine cannot resolve */
+    command.moveSteps = 100000000;
+    if (shootingGameApply(game, &command, &result) != SHOOTING_GAME_STATUS_INVALID_ARGUMENT ||
+        result.status != SHOOTING_GAME_STATUS_INVALID_ARGUMENT)
+        return failCheck("a move far past the largest map is resolved");
+    command.moveSteps = SHOOTING_GAME_MAX_MOVE_STEPS + 1;
+    if (shootingGameApply(game, &command, NULL) != SHOOTING_GAME_STATUS_INVALID_ARGUMENT)
+        return failCheck("a move one step past the largest map is resolved");
+    command.moveSteps = -1;
+    if (shootingGameApply(game, &command, NULL) != SHOOTING_GAME_STATUS_INVALID_ARGUMENT)
+        return failCheck("a move of negative steps is resolved");
+    command.moveSteps = 1;
+    command.robotLetter = 'x';
+    if (shootingGameApply(game, &command, NULL) != SHOOTING_GAME_STATUS_INVALID_ARGUMENT)
+        return failCheck("a command of a robot outside A..Z is resolved");
+    if (shootingGameGetCell(game, 0, 0) != 'A' || shootingGameGetCell(game, 0, 4) != 'B')
+        return failCheck("a rejected command changed the map");
+
+    /* the commands next to them still play out */
+    command.robotLetter = 'B';
+    command.directionLetter = SHOOTING_GAME_DIRECTION_EAST;
+    command.moveSteps = SHOOTING_GAME_MAX_MOVE_STEPS;
+    if (shootingGameApply(game, &command, NULL) != SHOOTING_GAME_STATUS_MOVE_OUTSIDE_BOUNDARY)
+        return failCheck("the longest move is not resolved");
+    command.robotLetter = 'A';
+    command.moveSteps = 1;
+    if (shootingGameApply(game, &command, NULL) != SHOOTING_GAME_STATUS_MOVE_SUCCESS ||
+        shootingGameGetCell(game, 0, 1) != 'A')
+        return failCheck("a move of one step is not resolved");
+    command.actionLetter = SHOOTING_GAME_ACTION_SHOOT;
+    if (shootingGameApply(game, &command, NULL) != SHOOTING_GAME_STATUS_WEAPON_FAIL ||
+        shootingGameGetHealthPoint(game, 'B') != 100)
+        return failCheck("a shot through a wall is resolved");
+
+    /* queries outside the game */
+    if (shootingGameGetCell(game, 0, 5) != SHOOTING_GAME_CELL_NONE || shootingGameGetCell(game, -1, 0) != SHOOTING_GAME_CELL_NONE)
+        return failCheck("a cell off the map is read");
+    if (shootingGameGetHealthPoint(game, 'x') != SHOOTING_GAME_HEALTH_POINT_NONE)
+        return failCheck("the health points of a robot outside A..Z are read");
+
+    shootingGameDestroy(game);
+    printf("Success: the C interface checks its arguments\n");
+    return 0;
+}
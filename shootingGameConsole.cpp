@@ -0,0 +1,331 @@
+#include <iostream>
+#include <cstring>
+#include "shootingGame.h"
+#include "shootingGameConsole.h"
+using namespace std;
+
+// Helper function: convert an action text to a letter
+// It is easier to compare characters than strings
+char actionTextToLetter(const char actionText[MAX_ACTION_TEXT_LENGTH])
+{
+    // In this game, only 4 possible values
+    if (strcmp(actionText, ACTION_MOVE_TEXT) == 0)
+    {
+        return ACTION_MOVE;
+    }
+    else if (strcmp(actionText, ACTION_HIT_TEXT) == 0)
+    {
+        return ACTION_HIT;
+    }
+    else if (strcmp(actionText, ACTION_SHOOT_TEXT) == 0)
+    {
+        return ACTION_SHOOT;
+    }
+    else if (strcmp(actionText, ACTION_MOVETO_TEXT) == 0)
+    {
+        return ACTION_MOVETO;
+    }
+    return ACTION_ERROR;
+}
+
+// Helper function: convert a direction text to a letter
+// It is easier to compare characters than strings
+char directionTextToLetter(const char directionText[MAX_DIRECTION_TEXT_LENGTH])
+{
+    // In this game, only 4 possible directions
+    if (strcmp(directionText, DIRECTION_EAST_TEXT) == 0)
+    {
+        return DIRECTION_EAST;
+    }
+    else if (strcmp(directionText, DIRECTION_SOUTH_TEXT) == 0)
+    {
+        return DIRECTION_SOUTH;
+    }
+    else if (strcmp(directionText, DIRECTION_WEST_TEXT) == 0)
+    {
+        return DIRECTION_WEST;
+    }
+    else if (strcmp(directionText, DIRECTION_NORTH_TEXT) == 0)
+    {
+        return DIRECTION_NORTH;
+    }
+    return DIRECTION_ERROR;
+}
+
+// Helper function: convert a direction letter to text
+const char *letterToDirectionText(char direction)
+{
+    if (direction == DIRECTION_EAST)
+        return DIRECTION_EAST_TEXT;
+    else if (direction == DIRECTION_SOUTH)
+        return DIRECTION_SOUTH_TEXT;
+    else if (direction == DIRECTION_WEST)
+        return DIRECTION_WEST_TEXT;
+    else if (direction == DIRECTION_NORTH)
+        return DIRECTION_NORTH_TEXT;
+    return DIRECTION_ERROR_TEXT;
+}
+
+// Helper function: Read the map information
+void readInputMap(char map[MAX_ROWS][MAX_COLS], int &mapRows, int &mapCols)
+{
+    int r, c;
+    char line[MAX_COLS + 1]; // character array to store each line
+
+    // Read the game map
+    cin >> mapRows >> mapCols;
+    initializeMap(map, mapRows, mapCols);
+
+    cin.ignore(); // ignore the end line character in this line
+    for (r = 0; r < mapRows; r++)
+    {
+        cin.getline(line, MAX_COLS + 1);
+        for (c = 0; c < mapCols; c++)
+            map[r][c] = line[c];
+    }
+}
+
+// Helper function: Read the robot information
+// Each robot line may end with a team number, e.g. "A 500 1"; robots without one are on team 0
+void readInputHealthPoints(int healthPoints[MAX_NUM_ROBOTS], int teams[MAX_NUM_ROBOTS])
+{
+    int numRobots, hp, team, i;
+    char robotLetter;
+
+    initializeHealthPoints(healthPoints);
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+        teams[i] = 0;
+    // Read robot letters and health points
+    cin >> numRobots;
+    for (i = 0; i < numRobots; i++)
+    {
+        cin >> robotLetter >> hp;
+        // cout << robotLetter << hp << endl;
+        healthPoints[robotLetterToArrayIndex(robotLetter)] = hp;
+
+        // the optional team number, on the same line
+        while (cin.peek() == ' ' || cin.peek() == '\t')
+            cin.get();
+        if (cin.peek() >= '0' && cin.peek() <= '9')
+        {
+            cin >> team;
+            if (team >= 0 && team < MAX_NUM_TEAMS)
+                teams[robotLetterToArrayIndex(robotLetter)] = team;
+        }
+    }
+}
+
+// Helper function: Display the game map
+void displayMap(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols)
+{
+    int r, c;
+    for (r = 0; r < mapRows; r++)
+    {
+        for (c = 0; c < mapCols; c++)
+            cout << map[r][c] << " ";
+        cout << endl;
+    }
+}
+
+// Helper function: whether the output may name a robot
+// Without visibleRobots every robot may be named
+bool isRobotDisplayed(const bool visibleRobots[MAX_NUM_ROBOTS], const char robotLetter)
+{
+    int index = robotLetterToArrayIndex(robotLetter);
+    return visibleRobots == NULL || (index >= 0 && index < MAX_NUM_ROBOTS && visibleRobots[index]);
+}
+
+// Helper function: Display the health point information
+void displayHealthPoints(const int healthPoints[MAX_NUM_ROBOTS], const bool visibleRobots[MAX_NUM_ROBOTS])
+{
+    int i, hp;
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+    {
+        hp = healthPoints[i];
+        if (hp > 0 && isRobotDisplayed(visibleRobots, arrayIndexToRobotLetter(i)))
+        {
+            cout << "Robot " << arrayIndexToRobotLetter(i) << " HP=" << hp << endl;
+        }
+    }
+}
+
+// Helper function: Display the numbers of every team that had robots, and the winner if any
+// With a fog team, only its own numbers are shown
+void displayTeamScoreboard(const Game &game, const int fogTeam)
+{
+    int team;
+    cout << "== Team scoreboard ==" << endl;
+    for (team = 0; team < MAX_NUM_TEAMS; team++)
+    {
+        const TeamStatistics &statistics = game.getTeamStatistics(team);
+        if (fogTeam != TEAM_NONE && team != fogTeam)
+            continue;
+        if (statistics.aliveCount > 0 || statistics.kills > 0)
+            cout << "Team " << team << ": alive=" << statistics.aliveCount << " HP=" << statistics.totalHealthPoints
+                 << " kills=" << statistics.kills << endl;
+    }
+    if (game.getWinningTeam() != TEAM_NONE)
+        cout << "Team " << game.getWinningTeam() << " wins" << endl;
+}
+
+// Helper function: Read the next command
+// Returns false at the end of the input
+bool readInputCommand(Command &command)
+{
+    char actionText[MAX_ACTION_TEXT_LENGTH];
+    char directionText[MAX_DIRECTION_TEXT_LENGTH];
+
+    command.robotLetter = CHAR_END_INPUT;
+    command.actionLetter = ACTION_ERROR;
+    command.directionLetter = DIRECTION_ERROR;
+    command.moveSteps = 0;
+    command.targetRow = command.targetCol = 0;
+
+    cin >> command.robotLetter;
+    if (!cin || command.robotLetter == CHAR_END_INPUT)
+        return false; // End of the game
+
+    // if the robot letter is not the end of the game
+    // read the action text, then either the target cell or the direction letter
+    cin >> actionText;
+    command.actionLetter = actionTextToLetter(actionText);
+    if (command.actionLetter == ACTION_MOVETO)
+    {
+        cin >> command.targetRow >> command.targetCol;
+        return true;
+    }
+
+    cin >> directionText;
+    command.directionLetter = directionTextToLetter(directionText);
+    if (command.actionLetter == ACTION_MOVE)
+    {
+        // need to read the steps if the action is ACTION_MOVE
+        cin >> command.moveSteps;
+    }
+    return true;
+}
+
+// Helper function: Display the outcome of a command, given the state after it
+// With visibleRobots, a command of a hidden robot only shows the map and the visible health points,
+// and a hidden target is not named
+void displayActionResult(const Command &command, const ActionResult &result,
+                         const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                         const int healthPoints[MAX_NUM_ROBOTS], const bool visibleRobots[MAX_NUM_ROBOTS])
+{
+    const char robotLetter = command.robotLetter;
+    const char *directionText = letterToDirectionText(command.directionLetter);
+
+    if (!isRobotDisplayed(visibleRobots, robotLetter))
+    {
+        cout << "A hidden robot acts" << endl;
+        displayMap(map, mapRows, mapCols);
+        if (command.actionLetter == ACTION_HIT || command.actionLetter == ACTION_SHOOT)
+        {
+            cout << "== Health points of alive robots ==" << endl;
+            displayHealthPoints(healthPoints, visibleRobots);
+        }
+    }
+    else if (command.actionLetter == ACTION_MOVETO)
+    {
+        if (result.status == STATUS_ACTION_MOVE_NOT_IMPLMENTED)
+        {
+            cout << "The moveto action is not implemented yet" << endl;
+        }
+        else if (result.status == STATUS_ACTION_MOVE_SUCCESS)
+        {
+            cout << "Success: "
+                 << "Robot " << robotLetter << " moves to (" << command.targetRow << ", " << command.targetCol << ") in " << result.pathSteps << " step(s)" << endl;
+            displayMap(map, mapRows, mapCols);
+        }
+        else if (result.status == STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY)
+        {
+            cout << "Fail: "
+                 << "If robot " << robotLetter << " moves to (" << command.targetRow << ", " << command.targetCol << ")"
+                 << ", it will move outside a boundary, so the position remains unchanged" << endl;
+            displayMap(map, mapRows, mapCols);
+        }
+        else if (result.status == STATUS_ACTION_MOVE_NO_PATH)
+        {
+            cout << "Fail: "
+                 << "Robot " << robotLetter << " cannot find a path to (" << command.targetRow << ", " << command.targetCol << ")"
+                 << ", so the position remains unchanged" << endl;
+            displayMap(map, mapRows, mapCols);
+        }
+    }
+    else if (command.actionLetter == ACTION_MOVE)
+    {
+        if (result.status == STATUS_ACTION_MOVE_NOT_IMPLMENTED)
+        {
+            cout << "The move action is not implemented yet" << endl;
+        }
+        else if (result.status == STATUS_ACTION_MOVE_SUCCESS)
+        {
+            cout << "Success: "
+                 << "Robot " << robotLetter << " moves along the direction " << directionText << " by " << command.moveSteps << " step(s)" << endl;
+            displayMap(map, mapRows, mapCols);
+        }
+        else if (result.status == STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY)
+        {
+            cout << "Fail: "
+                 << "If robot " << robotLetter << " moves along the direction " << directionText << " by " << command.moveSteps << " step(s)"
+                 << ", it will move outside a boundary, so the position remains unchanged" << endl;
+            displayMap(map, mapRows, mapCols);
+        }
+        else if (result.status == STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH)
+        {
+            cout << "Fail: "
+                 << "If robot " << robotLetter << " moves along the direction " << directionText << " by " << command.moveSteps << " step(s)"
+                 << ", it will hit another robot along the path, so the position remains unchanged" << endl;
+            displayMap(map, mapRows, mapCols);
+        }
+        else if (result.status == STATUS_ACTION_MOVE_HIT_WALL_ALONG_PATH)
+        {
+            cout << "Fail: "
+                 << "If robot " << robotLetter << " moves along the direction " << directionText << " by " << command.moveSteps << " step(s)"
+                 << ", it will hit a wall along the path, so the position remains unchanged" << endl;
+            displayMap(map, mapRows, mapCols);
+        }
+    }
+    else if (command.actionLetter == ACTION_HIT || command.actionLetter == ACTION_SHOOT)
+    {
+        const bool hit = (command.actionLetter == ACTION_HIT);
+        if (result.status == STATUS_ACTION_WEAPON_NOT_IMPLEMENTED)
+        {
+            cout << "The " << (hit ? "hit" : "shoot") << " action is not implemented yet" << endl;
+        }
+        else if (result.status == STATUS_ACTION_WEAPON_SUCCESS && !isRobotDisplayed(visibleRobots, result.targetRobotLetter))
+        {
+            cout << "Success: "
+                 << "Robot " << robotLetter << (hit ? " hits" : " shoots") << " a hidden robot" << endl;
+            cout << "== Health points of alive robots ==" << endl;
+            displayHealthPoints(healthPoints, visibleRobots);
+        }
+        else if (result.status == STATUS_ACTION_WEAPON_SUCCESS)
+        {
+            cout << "Success: "
+                 << "Robot " << robotLetter << (hit ? " hits " : " shoots ") << result.targetRobotLetter << endl;
+            cout << "Robot " << result.targetRobotLetter << " health point is reduced from " << result.targetOriginalHealthPoint << " to " << result.targetUpdatedHealthPoint << endl;
+            if (result.targetUpdatedHealthPoint == 0)
+            {
+                cout << "Robot " << result.targetRobotLetter << " is being destroyed by " << robotLetter << endl;
+                displayMap(map, mapRows, mapCols);
+            }
+            cout << "== Health points of alive robots ==" << endl;
+            displayHealthPoints(healthPoints, visibleRobots);
+        }
+        else if (result.status == STATUS_ACTION_WEAPON_FAIL)
+        {
+            cout << "Fail: "
+                 << "Robot " << robotLetter << (hit ? " cannot hit any target" : " cannot shoot any target") << endl;
+            cout << "== Health points of alive robots ==" << endl;
+            displayHealthPoints(healthPoints, visibleRobots);
+        }
+        else if (result.status == STATUS_ACTION_WEAPON_MISS)
+        {
+            cout << "Fail: "
+                 << "Robot " << robotLetter << (hit ? " misses its hit" : " misses its shot") << endl;
+            cout << "== Health points of alive robots ==" << endl;
+            displayHealthPoints(healthPoints, visibleRobots);
+        }
+    }
+}
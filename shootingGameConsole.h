@@ -0,0 +1,39 @@
+#ifndef SHOOTING_GAME_CONSOLE_H
+#define SHOOTING_GAME_CONSOLE_H
+
+// The text input and output of the command-line game, on cin and cout.
+// It lives outside the engine library so that embedders of the engine do not pull in iostream.
+
+#include "shootingGame.h"
+
+const int MAX_ACTION_TEXT_LENGTH = 10 + 1;    // array size for the action text, +1 for the NULL character
+const int MAX_DIRECTION_TEXT_LENGTH = 10 + 1; // array size for the direction text, +1 for the NULL character
+const char CHAR_END_INPUT = '!';
+const char DIRECTION_EAST_TEXT[] = "east";
+const char DIRECTION_WEST_TEXT[] = "west";
+const char DIRECTION_SOUTH_TEXT[] = "south";
+const char DIRECTION_NORTH_TEXT[] = "north";
+const char DIRECTION_ERROR_TEXT[] = "error";
+const char ACTION_MOVE_TEXT[] = "moves";
+const char ACTION_HIT_TEXT[] = "hits";
+const char ACTION_SHOOT_TEXT[] = "shoots";
+const char ACTION_MOVETO_TEXT[] = "moveto";
+
+// Helper functions
+char actionTextToLetter(const char actionText[MAX_ACTION_TEXT_LENGTH]);
+char directionTextToLetter(const char directionText[MAX_DIRECTION_TEXT_LENGTH]);
+const char *letterToDirectionText(char direction);
+
+// Input and output of the command-line game, on cin and cout
+void readInputMap(char map[MAX_ROWS][MAX_COLS], int &mapRows, int &mapCols);
+void readInputHealthPoints(int healthPoints[MAX_NUM_ROBOTS], int teams[MAX_NUM_ROBOTS]);
+bool readInputCommand(Command &command);
+void displayMap(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols);
+// With visibleRobots, only the robots set in it are named and listed; see Game::markVisibleRobots
+void displayHealthPoints(const int healthPoints[MAX_NUM_ROBOTS], const bool visibleRobots[MAX_NUM_ROBOTS] = NULL);
+void displayTeamScoreboard(const Game &game, const int fogTeam = TEAM_NONE);
+void displayActionResult(const Command &command, const ActionResult &result,
+                         const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                         const int healthPoints[MAX_NUM_ROBOTS], const bool visibleRobots[MAX_NUM_ROBOTS] = NULL);
+
+#endif
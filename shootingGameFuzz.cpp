@@ -0,0 +1,723 @@
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include "shootingGame.h"
+#include "shootingGameConsole.h"
+#include "shootingGameReference.h"
+#include "philoxRandom.h"
+using namespace std;
+
+// Differential fuzzing
+const int FUZZ_MAX_COMMANDS = 64;        // number of commands generated for each scenario
+const int FUZZ_MAX_HEALTH_POINT = 1000;  // robots start with 1..FUZZ_MAX_HEALTH_POINT health points
+const int FUZZ_MAX_MOVE_STEPS = 5;
+const int FUZZ_MAX_NUM_TEAMS = 4;
+const int FUZZ_MAX_WALL_SHARE = 4;       // walls take up to 1 in FUZZ_MAX_WALL_SHARE cells of a walled map
+const int FUZZ_EFFECT_SHARE = 8;         // a health point effect comes before 1 in FUZZ_EFFECT_SHARE commands
+const int FUZZ_MAX_EFFECT_CHANGE = 300;  // effects change the health points by up to this much either way
+const int STATUS_FUZZ_MATCH = 0;
+const int STATUS_FUZZ_MISMATCH = 1;
+
+// The bytes a scenario is generated from: either a fuzzer-provided buffer or a seeded generator
+struct FuzzInput
+{
+    const unsigned char *data;
+    size_t size;
+    size_t position;
+    unsigned int state;
+};
+
+// Accumulated time spent in each engine, in nanoseconds
+struct FuzzTimings
+{
+    long long engineTime;
+    long long referenceTime;
+};
+
+// Helper function: take the next byte of a scenario
+// A buffer that runs out keeps producing zeros, a seeded generator never runs out
+unsigned int nextFuzzByte(FuzzInput &input)
+{
+    if (input.data != NULL)
+    {
+        if (input.position < input.size)
+            return input.data[input.position++];
+        return 0;
+    }
+    // xorshift32
+    input.state ^= input.state << 13;
+    input.state ^= input.state >> 17;
+    input.state ^= input.state << 5;
+    return input.state & 0xFF;
+}
+
+// Helper function: take a number in [low, high] from the scenario bytes
+int nextFuzzNumber(FuzzInput &input, const int low, const int high)
+{
+    unsigned int value = nextFuzzByte(input);
+    value = (value << 8) | nextFuzzByte(input);
+    return low + int(value % (unsigned int)(high - low + 1));
+}
+
+// Helper function: compare the two engines after a step
+bool fuzzStatesMatch(const char engineMap[MAX_ROWS][MAX_COLS], const int engineHealthPoints[MAX_NUM_ROBOTS],
+                     const char referenceMap[MAX_ROWS][MAX_COLS], const int referenceHealthPoints[MAX_NUM_ROBOTS],
+                     const int mapRows, const int mapCols)
+{
+    int r, c, i;
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            if (engineMap[r][c] != referenceMap[r][c])
+                return false;
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+        if (engineHealthPoints[i] != referenceHealthPoints[i])
+            return false;
+    return true;
+}
+
+// Helper function: check the game's incrementally maintained team numbers against a recount
+bool fuzzTeamStatisticsMatch(const Game &game)
+{
+    int aliveCount[MAX_NUM_TEAMS] = {0}, totalHealthPoints[MAX_NUM_TEAMS] = {0};
+    int numTeamsAlive = 0, lastTeamAlive = TEAM_NONE;
+    int i, team;
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+    {
+        int hp = game.getHealthPoints()[i];
+        if (hp > 0)
+        {
+            team = game.getRobotTeam(arrayIndexToRobotLetter(i));
+            aliveCount[team]++;
+            totalHealthPoints[team] += hp;
+        }
+    }
+    for (team = 0; team < MAX_NUM_TEAMS; team++)
+    {
+        if (aliveCount[team] != game.getTeamStatistics(team).aliveCount ||
+            totalHealthPoints[team] != game.getTeamStatistics(team).totalHealthPoints)
+            return false;
+        if (aliveCount[team] > 0)
+        {
+            numTeamsAlive++;
+            lastTeamAlive = team;
+        }
+    }
+    return numTeamsAlive == game.getNumTeamsAlive() &&
+           game.getWinningTeam() == (numTeamsAlive == 1 ? lastTeamAlive : TEAM_NONE);
+}
+
+// Helper function: check a team's bitboard visibility against walking every line of sight cell by cell
+bool fuzzVisibilityMatches(Game &game, const int team)
+{
+    bool visible[MAX_ROWS][MAX_COLS] = {{false}};
+    const int mapRows = game.getMapRows(), mapCols = game.getMapCols();
+    int i, rowOffset, colOffset, k, stepRow, stepCol, r, c;
+
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+    {
+        char robotLetter = arrayIndexToRobotLetter(i);
+        int robotRow, robotCol;
+        if (game.getRobotTeam(robotLetter) != team || game.getHealthPoint(robotLetter) <= 0 ||
+            !game.getRobotLocation(robotLetter, robotRow, robotCol))
+            continue;
+        visible[robotRow][robotCol] = true;
+        for (rowOffset = -VISIBILITY_RADIUS; rowOffset <= VISIBILITY_RADIUS; rowOffset++)
+            for (colOffset = -VISIBILITY_RADIUS; colOffset <= VISIBILITY_RADIUS; colOffset++)
+            {
+                r = robotRow + rowOffset;
+                c = robotCol + colOffset;
+                if (r < 0 || r >= mapRows || c < 0 || c >= mapCols ||
+                    rowOffset * rowOffset + colOffset * colOffset > VISIBILITY_RADIUS * VISIBILITY_RADIUS)
+                    continue;
+                bool open = true;
+                for (k = 1; k < max(abs(rowOffset), abs(colOffset)) && open; k++)
+                {
+                    getLineOfSightCell(rowOffset, colOffset, k, stepRow, stepCol);
+                    open = (game.getCell(robotRow + stepRow, robotCol + stepCol) == CHAR_EMPTY);
+                }
+                if (open)
+                    visible[r][c] = true;
+            }
+    }
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            if (visible[r][c] != game.isCellVisible(team, r, c))
+                return false;
+    return true;
+}
+
+// Helper function: check the precomputed wall distances against walking every ray cell by cell
+bool fuzzWallDistancesMatch(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols)
+{
+    int wallDistances[MAX_ROWS][MAX_COLS][NUM_DIRECTIONS];
+    const int stepRows[NUM_DIRECTIONS] = {0, 1, 0, -1}; // in the order of the DIRECTION_INDEX_ constants
+    const int stepCols[NUM_DIRECTIONS] = {1, 0, -1, 0};
+    int r, c, d, k;
+
+    computeWallDistances(map, mapRows, mapCols, wallDistances);
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            for (d = 0; d < NUM_DIRECTIONS; d++)
+            {
+                int distance = WALL_DISTANCE_NONE;
+                for (k = 1; distance == WALL_DISTANCE_NONE; k++)
+                {
+                    int nr = r + k * stepRows[d], nc = c + k * stepCols[d];
+                    if (nr < 0 || nr >= mapRows || nc < 0 || nc >= mapCols)
+                        break;
+                    if (map[nr][nc] == CHAR_WALL)
+                        distance = k;
+                }
+                if (wallDistances[r][c][d] != distance)
+                    return false;
+            }
+    return true;
+}
+
+// Helper function: find the outcome of a move, hit or shoot that a wall decides, by walking its ray
+// cell by cell. A wall anywhere along a move's path stops it, a weapon stops at whatever it reaches
+// first. Returns false when no wall is in the way, so the frozen reference can decide the command
+bool fuzzWallDecides(const char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                     const int robotRow, const int robotCol, const char actionLetter,
+                     const char directionLetter, const int moveSteps, int &status)
+{
+    const int stepRows[NUM_DIRECTIONS] = {0, 1, 0, -1};
+    const int stepCols[NUM_DIRECTIONS] = {1, 0, -1, 0};
+    const int d = directionLetterToIndex(directionLetter);
+    int reach, k;
+
+    if (d < 0)
+        return false;
+    if (actionLetter == ACTION_MOVE)
+        reach = moveSteps;
+    else if (actionLetter == ACTION_HIT)
+        reach = 1;
+    else
+        reach = WEAPON_SHOOT_RANGE;
+    for (k = 1; k <= reach; k++)
+    {
+        int r = robotRow + k * stepRows[d], c = robotCol + k * stepCols[d];
+        if (r < 0 || r >= mapRows || c < 0 || c >= mapCols)
+            return false;
+        if (map[r][c] == CHAR_WALL)
+        {
+            status = (actionLetter == ACTION_MOVE) ? STATUS_ACTION_MOVE_HIT_WALL_ALONG_PATH : STATUS_ACTION_WEAPON_FAIL;
+            return true;
+        }
+        if (map[r][c] != CHAR_EMPTY && actionLetter != ACTION_MOVE)
+            return false;
+    }
+    return false;
+}
+
+// Helper function: resolve a moveto on the reference map with a fresh breadth-first search from
+// the robot, so the engine's cached distance fields are checked against a search that keeps nothing
+int fuzzReferenceMoveTo(char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                        const char robotLetter, const int targetRow, const int targetCol, int &pathSteps)
+{
+    int distance[MAX_ROWS][MAX_COLS];
+    int queueRows[MAX_ROWS * MAX_COLS], queueCols[MAX_ROWS * MAX_COLS];
+    const int stepRows[4] = {-1, 0, 1, 0};
+    const int stepCols[4] = {0, 1, 0, -1};
+    int head = 0, tail = 0;
+    int robotRow, robotCol, r, c, d;
+
+    pathSteps = 0;
+    if (!findRobotLocation(map, mapRows, mapCols, robotLetter, robotRow, robotCol))
+        return STATUS_ACTION_MOVE_NOT_IMPLMENTED;
+    if (targetRow < 0 || targetRow >= mapRows || targetCol < 0 || targetCol >= mapCols)
+        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+    if (targetRow == robotRow && targetCol == robotCol)
+        return STATUS_ACTION_MOVE_SUCCESS;
+
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            distance[r][c] = DISTANCE_UNREACHABLE;
+    distance[robotRow][robotCol] = 0;
+    queueRows[tail] = robotRow;
+    queueCols[tail] = robotCol;
+    tail++;
+    while (head < tail)
+    {
+        r = queueRows[head];
+        c = queueCols[head];
+        head++;
+        if (r == targetRow && c == targetCol)
+        {
+            pathSteps = distance[r][c];
+            map[robotRow][robotCol] = CHAR_EMPTY;
+            map[r][c] = robotLetter;
+            return STATUS_ACTION_MOVE_SUCCESS;
+        }
+        for (d = 0; d < 4; d++)
+        {
+            int nr = r + stepRows[d], nc = c + stepCols[d];
+            if (nr < 0 || nr >= mapRows || nc < 0 || nc >= mapCols)
+                continue;
+            if (map[nr][nc] != CHAR_EMPTY || distance[nr][nc] != DISTANCE_UNREACHABLE)
+                continue;
+            distance[nr][nc] = distance[r][c] + 1;
+            queueRows[tail] = nr;
+            queueCols[tail] = nc;
+            tail++;
+        }
+    }
+    return STATUS_ACTION_MOVE_NO_PATH;
+}
+
+// Helper function: check the in-place repairs of a distance field against searching it again,
+// while walls are put on and taken off random cells of a random map; the target never changes
+bool fuzzDistanceFieldRepairsMatch(FuzzInput &input)
+{
+    char map[MAX_ROWS][MAX_COLS];
+    DistanceField field, fresh;
+    const int mapRows = nextFuzzNumber(input, 1, MAX_ROWS), mapCols = nextFuzzNumber(input, 1, MAX_COLS);
+    int r, c, step;
+
+    initializeMap(map, MAX_ROWS, MAX_COLS);
+    for (r = 0; r < mapRows; r++)
+        for (c = 0; c < mapCols; c++)
+            if (nextFuzzNumber(input, 0, 2) == 0)
+                map[r][c] = CHAR_WALL;
+    field.targetRow = fresh.targetRow = nextFuzzNumber(input, 0, mapRows - 1);
+    field.targetCol = fresh.targetCol = nextFuzzNumber(input, 0, mapCols - 1);
+    computeDistanceField(map, mapRows, mapCols, field);
+
+    for (step = 0; step < FUZZ_MAX_COMMANDS; step++)
+    {
+        r = nextFuzzNumber(input, 0, mapRows - 1);
+        c = nextFuzzNumber(input, 0, mapCols - 1);
+        if (r == field.targetRow && c == field.targetCol)
+            continue;
+        if (map[r][c] == CHAR_EMPTY)
+        {
+            map[r][c] = CHAR_WALL;
+            blockDistanceFieldCell(field, mapRows, mapCols, r, c);
+        }
+        else
+        {
+            map[r][c] = CHAR_EMPTY;
+            openDistanceFieldCell(field, mapRows, mapCols, r, c);
+        }
+        computeDistanceField(map, mapRows, mapCols, fresh);
+        for (r = 0; r < mapRows; r++)
+            for (c = 0; c < mapCols; c++)
+                if (field.distance[r][c] != fresh.distance[r][c])
+                    return false;
+    }
+    return true;
+}
+
+// Helper function: check that moveto keeps its distance fields: one robot going round three
+// targets on a map where nothing else changes searches each target once. Two of the targets
+// share a row, so leaving one cuts the straight paths to the other.
+bool fuzzDistanceFieldsAreCached()
+{
+    char map[MAX_ROWS][MAX_COLS];
+    int healthPoints[MAX_NUM_ROBOTS];
+    const int targetRows[3] = {5, 5, 15}, targetCols[3] = {5, 25, 15};
+    Command command;
+    Game game;
+    int r, i;
+
+    initializeMap(map, MAX_ROWS, MAX_COLS);
+    initializeHealthPoints(healthPoints);
+    for (r = 3; r < 16; r++)
+        map[r][10] = CHAR_WALL;
+    map[0][0] = 'A';
+    map[5][20] = 'B';
+    map[12][3] = 'C';
+    healthPoints[0] = healthPoints[1] = healthPoints[2] = 100;
+    game.load(map, MAX_ROWS, MAX_COLS, healthPoints);
+
+    command.robotLetter = 'A';
+    command.actionLetter = ACTION_MOVETO;
+    command.directionLetter = DIRECTION_ERROR;
+    command.moveSteps = 0;
+    for (i = 0; i < 300; i++)
+    {
+        command.targetRow = targetRows[i % 3];
+        command.targetCol = targetCols[i % 3];
+        if (game.apply(command).status != STATUS_ACTION_MOVE_SUCCESS)
+            return false;
+    }
+    return game.getNumDistanceFieldSearches() == 3;
+}
+
+// Helper function: check the vectorized health point effect against adding the change to one
+// robot at a time, on a random number of robots so that the scalar tail runs too
+bool fuzzHealthPointsEffectMatches(FuzzInput &input)
+{
+    int healthPoints[MAX_NUM_ROBOTS], expectedHealthPoints[MAX_NUM_ROBOTS];
+    int destroyedIndices[MAX_NUM_ROBOTS], destroyedHealthPoints[MAX_NUM_ROBOTS];
+    const int numRobots = nextFuzzNumber(input, 0, MAX_NUM_ROBOTS);
+    const int change = nextFuzzNumber(input, -FUZZ_MAX_EFFECT_CHANGE, FUZZ_MAX_EFFECT_CHANGE);
+    int i, numExpected = 0;
+
+    // some robots are destroyed already, and must stay at their health points
+    for (i = 0; i < numRobots; i++)
+        healthPoints[i] = expectedHealthPoints[i] = nextFuzzNumber(input, -FUZZ_MAX_EFFECT_CHANGE, FUZZ_MAX_HEALTH_POINT);
+    const int numDestroyed = applyHealthPointsEffect(healthPoints, numRobots, change, destroyedIndices, destroyedHealthPoints);
+
+    for (i = 0; i < numRobots; i++)
+    {
+        if (expectedHealthPoints[i] <= 0)
+            continue;
+        if (expectedHealthPoints[i] + change > 0)
+        {
+            expectedHealthPoints[i] += change;
+            continue;
+        }
+        if (numExpected >= numDestroyed || destroyedIndices[numExpected] != i ||
+            destroyedHealthPoints[numExpected] != expectedHealthPoints[i])
+            return false;
+        numExpected++;
+        expectedHealthPoints[i] = 0;
+    }
+    if (numExpected != numDestroyed)
+        return false;
+    for (i = 0; i < numRobots; i++)
+        if (healthPoints[i] != expectedHealthPoints[i])
+            return false;
+    return true;
+}
+
+// Helper function: apply a health point effect to the game and, one robot at a time, to the
+// reference state, then check that they still match, with the destroyed robots and the team numbers
+bool fuzzGameHealthPointsEffectMatches(Game &game, char referenceMap[MAX_ROWS][MAX_COLS],
+                                       int referenceHealthPoints[MAX_NUM_ROBOTS], const int mapRows,
+                                       const int mapCols, const int change)
+{
+    char destroyedRobotLetters[MAX_NUM_ROBOTS];
+    const int numDestroyed = game.applyHealthPointsEffect(change, destroyedRobotLetters);
+    int i, row, col, numExpected = 0;
+
+    for (i = 0; i < MAX_NUM_ROBOTS; i++)
+    {
+        if (referenceHealthPoints[i] <= 0)
+            continue;
+        referenceHealthPoints[i] += change;
+        if (referenceHealthPoints[i] > 0)
+            continue;
+        referenceHealthPoints[i] = 0;
+        if (findRobotLocation(referenceMap, mapRows, mapCols, arrayIndexToRobotLetter(i), row, col))
+            referenceMap[row][col] = CHAR_EMPTY;
+        if (numExpected >= numDestroyed || destroyedRobotLetters[numExpected] != arrayIndexToRobotLetter(i))
+            return false;
+        numExpected++;
+    }
+    return numExpected == numDestroyed &&
+           fuzzStatesMatch(game.getMap(), game.getHealthPoints(), referenceMap, referenceHealthPoints, mapRows, mapCols) &&
+           fuzzTeamStatisticsMatch(game);
+}
+
+// Helper function: check Philox against the known-answer vectors of its authors (Random123 kat_vectors)
+bool fuzzPhiloxMatchesKnownAnswers()
+{
+    const uint32_t counters[3][4] = {{0x00000000, 0x00000000, 0x00000000, 0x00000000},
+                                     {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                                     {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}};
+    const uint32_t keys[3][2] = {{0x00000000, 0x00000000},
+                                 {0xffffffff, 0xffffffff},
+                                 {0xa4093822, 0x299f31d0}};
+    const uint32_t answers[3][4] = {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+                                    {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+                                    {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+    uint32_t result[4];
+    int i, j;
+    for (i = 0; i < 3; i++)
+    {
+        philox4x32(counters[i], keys[i], result);
+        for (j = 0; j < 4; j++)
+            if (result[j] != answers[i][j])
+                return false;
+    }
+    return true;
+}
+
+// Helper function: check that an attack that always misses only misses when it has a target
+bool fuzzMissesNeedTarget()
+{
+    char map[MAX_ROWS][MAX_COLS];
+    int healthPoints[MAX_NUM_ROBOTS];
+    RandomEvents events;
+    Command command;
+    Game game;
+
+    initializeMap(map, MAX_ROWS, MAX_COLS);
+    initializeHealthPoints(healthPoints);
+    map[0][0] = 'A';
+    healthPoints[0] = 100;
+    game.load(map, 1, 3, healthPoints);
+    initializeRandomEvents(events);
+    events.hitChance = 0;
+    game.setRandomEvents(events);
+    command.robotLetter = 'A';
+    command.directionLetter = DIRECTION_EAST;
+    command.moveSteps = command.targetRow = command.targetCol = 0;
+    command.actionLetter = ACTION_SHOOT;
+    if (game.apply(command).status != STATUS_ACTION_WEAPON_FAIL)
+        return false;
+
+    map[0][2] = 'B';
+    healthPoints[1] = 100;
+    game.load(map, 1, 3, healthPoints);
+    return game.apply(command).status == STATUS_ACTION_WEAPON_MISS && game.getHealthPoint('B') == 100;
+}
+
+// Run one generated scenario through a Game and the frozen reference, comparing the maps,
+// the health points and the status codes after every step.
+// Only commands on which the reference is well defined are generated: the acting robot is alive
+// on the map, moves to the north/west never look past the first row/column, and robots in the
+// first column never hit to the west. The reference predates walls and moveto: half of the maps
+// get walls, the commands a wall decides are checked against fuzzWallDecides, and movetos
+// against fuzzReferenceMoveTo. Health point effects come between the commands now and then,
+// applied to the reference one robot at a time.
+int runFuzzScenario(FuzzInput &input, FuzzTimings &timings, const bool verbose)
+{
+    Game game;
+    ActionResult engineResult;
+    char referenceMap[MAX_ROWS][MAX_COLS];
+    int referenceHealthPoints[MAX_NUM_ROBOTS];
+    int teams[MAX_NUM_ROBOTS] = {0};
+    char referenceTargetLetter = CHAR_EMPTY;
+    int referenceOriginal = 0, referenceUpdated = 0;
+    int referenceStatus, referencePathSteps = 0;
+    int mapRows, mapCols, numRobots;
+    int i, step;
+    const char directions[4] = {DIRECTION_EAST, DIRECTION_SOUTH, DIRECTION_WEST, DIRECTION_NORTH};
+    const char actions[4] = {ACTION_MOVE, ACTION_HIT, ACTION_SHOOT, ACTION_MOVETO};
+
+    mapRows = nextFuzzNumber(input, 1, MAX_ROWS);
+    mapCols = nextFuzzNumber(input, 1, MAX_COLS);
+    initializeMap(referenceMap, MAX_ROWS, MAX_COLS);
+    initializeHealthPoints(referenceHealthPoints);
+
+    numRobots = nextFuzzNumber(input, 1, min(MAX_NUM_ROBOTS, mapRows * mapCols));
+    for (i = 0; i < numRobots; i++)
+    {
+        // probe from a random cell to the next empty one, so placement always succeeds
+        int cell = nextFuzzNumber(input, 0, mapRows * mapCols - 1);
+        while (referenceMap[cell / mapCols][cell % mapCols] != CHAR_EMPTY)
+            cell = (cell + 1) % (mapRows * mapCols);
+        referenceMap[cell / mapCols][cell % mapCols] = arrayIndexToRobotLetter(i);
+        referenceHealthPoints[i] = nextFuzzNumber(input, 1, FUZZ_MAX_HEALTH_POINT);
+        teams[i] = nextFuzzNumber(input, 0, FUZZ_MAX_NUM_TEAMS - 1);
+    }
+
+    // walls go on the cells left empty, probing like the robots
+    int numWalls = 0, numEmptyCells = mapRows * mapCols - numRobots;
+    if (nextFuzzNumber(input, 0, 1) == 1)
+        numWalls = min(numEmptyCells, nextFuzzNumber(input, 0, mapRows * mapCols / FUZZ_MAX_WALL_SHARE));
+    for (i = 0; i < numWalls; i++)
+    {
+        int cell = nextFuzzNumber(input, 0, mapRows * mapCols - 1);
+        while (referenceMap[cell / mapCols][cell % mapCols] != CHAR_EMPTY)
+            cell = (cell + 1) % (mapRows * mapCols);
+        referenceMap[cell / mapCols][cell % mapCols] = CHAR_WALL;
+    }
+    if (!fuzzWallDistancesMatch(referenceMap, mapRows, mapCols))
+    {
+        if (verbose)
+        {
+            cout << "Mismatch in the wall distances of the map" << endl;
+            displayMap(referenceMap, mapRows, mapCols);
+        }
+        return STATUS_FUZZ_MISMATCH;
+    }
+    game.load(referenceMap, mapRows, mapCols, referenceHealthPoints, teams);
+
+    for (step = 0; step < FUZZ_MAX_COMMANDS; step++)
+    {
+        // now and then an effect on every robot first, e.g. poison or regeneration
+        if (nextFuzzNumber(input, 0, FUZZ_EFFECT_SHARE - 1) == 0)
+        {
+            int change = nextFuzzNumber(input, -FUZZ_MAX_EFFECT_CHANGE, FUZZ_MAX_EFFECT_CHANGE);
+            if (!fuzzGameHealthPointsEffectMatches(game, referenceMap, referenceHealthPoints, mapRows, mapCols, change))
+            {
+                if (verbose)
+                {
+                    cout << "Mismatch at step " << step << ": health point effect " << change << endl;
+                    cout << "== Engine ==" << endl;
+                    displayHealthPoints(game.getHealthPoints());
+                    displayMap(game.getMap(), mapRows, mapCols);
+                    cout << "== Reference ==" << endl;
+                    displayHealthPoints(referenceHealthPoints);
+                    displayMap(referenceMap, mapRows, mapCols);
+                }
+                return STATUS_FUZZ_MISMATCH;
+            }
+        }
+
+        int robotRow = 0, robotCol = 0;
+        int robotIndex = nextFuzzNumber(input, 0, numRobots - 1);
+        char robotLetter = CHAR_EMPTY;
+        char actionLetter = actions[nextFuzzNumber(input, 0, 3)];
+        char directionLetter = directions[nextFuzzNumber(input, 0, 3)];
+        int moveSteps = nextFuzzNumber(input, 1, FUZZ_MAX_MOVE_STEPS);
+        int targetRow = nextFuzzNumber(input, -1, mapRows), targetCol = nextFuzzNumber(input, -1, mapCols);
+        Command command;
+
+        // pick the next robot that is still alive on the map
+        for (i = 0; i < numRobots; i++)
+        {
+            robotLetter = arrayIndexToRobotLetter((robotIndex + i) % numRobots);
+            if (findRobotLocation(referenceMap, mapRows, mapCols, robotLetter, robotRow, robotCol))
+                break;
+        }
+        if (i == numRobots)
+            break; // every robot is destroyed
+
+        if (actionLetter == ACTION_MOVE && directionLetter == DIRECTION_NORTH && robotRow > 0)
+            moveSteps = min(moveSteps, robotRow);
+        if (actionLetter == ACTION_MOVE && directionLetter == DIRECTION_WEST && robotCol > 0)
+            moveSteps = min(moveSteps, robotCol);
+        if (actionLetter == ACTION_HIT && directionLetter == DIRECTION_WEST && robotCol == 0)
+            directionLetter = DIRECTION_EAST;
+
+        command.robotLetter = robotLetter;
+        command.actionLetter = actionLetter;
+        command.directionLetter = directionLetter;
+        command.moveSteps = moveSteps;
+        command.targetRow = targetRow;
+        command.targetCol = targetCol;
+
+        chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+        engineResult = game.apply(command);
+        chrono::steady_clock::time_point middleTime = chrono::steady_clock::now();
+        if (actionLetter == ACTION_MOVETO)
+            referenceStatus = fuzzReferenceMoveTo(referenceMap, mapRows, mapCols, robotLetter, targetRow, targetCol,
+                                                  referencePathSteps);
+        else if (fuzzWallDecides(referenceMap, mapRows, mapCols, robotRow, robotCol, actionLetter, directionLetter,
+                                 moveSteps, referenceStatus))
+        {
+            // a command stopped by a wall changes nothing
+        }
+        else if (actionLetter == ACTION_MOVE)
+            referenceStatus = referenceUpdateMapForMoveAction(referenceMap, mapRows, mapCols, robotLetter, directionLetter, moveSteps);
+        else if (actionLetter == ACTION_HIT)
+            referenceStatus = referenceUpdateHealthPointsForHitAction(referenceHealthPoints, referenceMap, mapRows, mapCols, robotLetter, directionLetter,
+                                                                      referenceTargetLetter, referenceOriginal, referenceUpdated);
+        else
+            referenceStatus = referenceUpdateHealthPointsForShootAction(referenceHealthPoints, referenceMap, mapRows, mapCols, robotLetter, directionLetter,
+                                                                        referenceTargetLetter, referenceOriginal, referenceUpdated);
+        chrono::steady_clock::time_point endTime = chrono::steady_clock::now();
+        timings.engineTime += chrono::duration_cast<chrono::nanoseconds>(middleTime - startTime).count();
+        timings.referenceTime += chrono::duration_cast<chrono::nanoseconds>(endTime - middleTime).count();
+
+        bool match = (engineResult.status == referenceStatus) &&
+                     fuzzStatesMatch(game.getMap(), game.getHealthPoints(), referenceMap, referenceHealthPoints, mapRows, mapCols);
+        if (match && actionLetter == ACTION_MOVETO)
+            match = (engineResult.pathSteps == referencePathSteps);
+        if (match && (actionLetter == ACTION_HIT || actionLetter == ACTION_SHOOT) &&
+            engineResult.status == STATUS_ACTION_WEAPON_SUCCESS)
+            match = (engineResult.targetRobotLetter == referenceTargetLetter) &&
+                    (engineResult.targetOriginalHealthPoint == referenceOriginal) &&
+                    (engineResult.targetUpdatedHealthPoint == referenceUpdated);
+        // the game's own bookkeeping must agree with the reference map too
+        if (match)
+            match = fuzzTeamStatisticsMatch(game);
+        for (i = 0; i < FUZZ_MAX_NUM_TEAMS && match; i++)
+            match = fuzzVisibilityMatches(game, i);
+        for (i = 0; i < numRobots && match; i++)
+        {
+            int referenceRow, referenceCol, engineRow, engineCol;
+            bool referenceFound = findRobotLocation(referenceMap, mapRows, mapCols, arrayIndexToRobotLetter(i),
+                                                    referenceRow, referenceCol);
+            bool engineFound = game.getRobotLocation(arrayIndexToRobotLetter(i), engineRow, engineCol);
+            match = (referenceFound == engineFound) &&
+                    (!referenceFound || (referenceRow == engineRow && referenceCol == engineCol));
+        }
+        if (!match)
+        {
+            if (verbose)
+            {
+                cout << "Mismatch at step " << step << ": robot " << robotLetter << " action " << actionLetter
+                     << " direction " << letterToDirectionText(directionLetter) << " steps " << moveSteps
+                     << " target (" << targetRow << ", " << targetCol << ")"
+                     << ", status " << engineResult.status << " (reference " << referenceStatus << ")" << endl;
+                cout << "== Engine ==" << endl;
+                displayHealthPoints(game.getHealthPoints());
+                displayMap(game.getMap(), mapRows, mapCols);
+                cout << "== Reference ==" << endl;
+                displayHealthPoints(referenceHealthPoints);
+                displayMap(referenceMap, mapRows, mapCols);
+            }
+            return STATUS_FUZZ_MISMATCH;
+        }
+    }
+    return STATUS_FUZZ_MATCH;
+}
+
+// Check Philox, the random events and the distance field cache, then run numScenarios seeded
+// scenarios, distance field repairs and health point effects; scenario i uses seed + i, so a
+// failure is reproduced by running that seed alone
+int runFuzzScenarios(const unsigned int seed, const int numScenarios)
+{
+    FuzzTimings timings = {0, 0};
+    int i;
+    if (!fuzzPhiloxMatchesKnownAnswers())
+    {
+        cout << "Fail: Philox does not match its known-answer vectors" << endl;
+        return 1;
+    }
+    if (!fuzzMissesNeedTarget())
+    {
+        cout << "Fail: an attack without a target is rolled" << endl;
+        return 1;
+    }
+    if (!fuzzDistanceFieldsAreCached())
+    {
+        cout << "Fail: moveto searches distance fields that it has cached" << endl;
+        return 1;
+    }
+    for (i = 0; i < numScenarios; i++)
+    {
+        unsigned int scenarioSeed = seed + unsigned(i);
+        FuzzInput input = {NULL, 0, 0, scenarioSeed == 0 ? 1 : scenarioSeed}; // xorshift never leaves zero
+        if (runFuzzScenario(input, timings, true) == STATUS_FUZZ_MISMATCH)
+        {
+            cout << "Fail: scenario with seed " << scenarioSeed << " differs from the reference" << endl;
+            return 1;
+        }
+        FuzzInput repairInput = {NULL, 0, 0, scenarioSeed == 0 ? 1 : scenarioSeed};
+        if (!fuzzDistanceFieldRepairsMatch(repairInput))
+        {
+            cout << "Fail: distance field repairs with seed " << scenarioSeed << " differ from a new search" << endl;
+            return 1;
+        }
+        if (!fuzzHealthPointsEffectMatches(repairInput))
+        {
+            cout << "Fail: the health point effect with seed " << scenarioSeed << " differs from one robot at a time" << endl;
+            return 1;
+        }
+    }
+    cout << "Success: " << numScenarios << " scenario(s) match the reference" << endl;
+    cout << "Engine time: " << timings.engineTime / 1000 << " us, reference time: " << timings.referenceTime / 1000 << " us" << endl;
+    return 0;
+}
+
+#ifdef SHOOTING_GAME_LIBFUZZER
+// Entry point for libFuzzer, e.g. clang++ -fsanitize=fuzzer -DSHOOTING_GAME_LIBFUZZER
+extern "C" int LLVMFuzzerTestOneInput(const unsigned char *data, size_t size)
+{
+    FuzzInput input = {data, size, 0, 0};
+    FuzzTimings timings = {0, 0};
+    if (runFuzzScenario(input, timings, true) == STATUS_FUZZ_MISMATCH)
+        abort();
+    return 0;
+}
+#endif
+
+#ifndef SHOOTING_GAME_LIBFUZZER
+// Usage: shootingGameFuzz <seed> <count>    compare the engine with the reference on count scenarios
+int main(int argc, char *argv[])
+{
+    if (argc != 3)
+    {
+        cout << "Usage: " << argv[0] << " <seed> <count>" << endl;
+        return 2;
+    }
+    return runFuzzScenarios(unsigned(strtoul(argv[1], NULL, 10)), atoi(argv[2]));
+}
+#endif
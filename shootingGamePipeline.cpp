@@ -0,0 +1,103 @@
+#include <iostream>
+#include <thread>
+#include "shootingGame.h"
+#include "shootingGameConsole.h"
+#include "shootingGamePipeline.h"
+#include "spscRingBuffer.h"
+using namespace std;
+
+// What the formatter needs to print one command: the command, its result and the state right
+// after it. An event whose command has CHAR_END_INPUT as the robot letter ends the stream.
+struct PipelineEvent
+{
+    Command command;
+    ActionResult result;
+    char map[MAX_ROWS][MAX_COLS];
+    int healthPoints[MAX_NUM_ROBOTS];
+    bool visibleRobots[MAX_NUM_ROBOTS]; // with a fog team, the robots it saw during the command
+};
+
+typedef SpscRingBuffer<Command, PIPELINE_COMMAND_QUEUE_CAPACITY> CommandQueue;
+typedef SpscRingBuffer<PipelineEvent, PIPELINE_EVENT_QUEUE_CAPACITY> EventQueue;
+
+// Stage 1: read and parse the commands
+void runPipelineReader(CommandQueue &commands)
+{
+    Command command;
+    while (readInputCommand(command))
+        commands.push(command);
+    command.robotLetter = CHAR_END_INPUT;
+    commands.push(command);
+}
+
+// Stage 2: resolve the commands, snapshotting the state for the formatter
+void runPipelineSimulation(Game &game, CommandQueue &commands, EventQueue &events, const int fogTeam)
+{
+    PipelineEvent event;
+    int r, c, i;
+    const int mapRows = game.getMapRows(), mapCols = game.getMapCols();
+
+    while (true)
+    {
+        commands.pop(event.command);
+        if (event.command.robotLetter == CHAR_END_INPUT)
+            break;
+        if (fogTeam != TEAM_NONE)
+        {
+            for (i = 0; i < MAX_NUM_ROBOTS; i++)
+                event.visibleRobots[i] = false;
+            game.markVisibleRobots(fogTeam, event.visibleRobots);
+        }
+        event.result = game.apply(event.command);
+        if (fogTeam != TEAM_NONE)
+            game.markVisibleRobots(fogTeam, event.visibleRobots);
+
+        const char(*map)[MAX_COLS] = game.getMap();
+        const int *healthPoints = game.getHealthPoints();
+        if (fogTeam != TEAM_NONE)
+            game.getVisibleMap(fogTeam, event.map);
+        else
+            for (r = 0; r < mapRows; r++)
+                for (c = 0; c < mapCols; c++)
+                    event.map[r][c] = map[r][c];
+        for (i = 0; i < MAX_NUM_ROBOTS; i++)
+            event.healthPoints[i] = healthPoints[i];
+        events.push(event);
+    }
+    events.push(event);
+}
+
+// Stage 3: format the output
+void runPipelineFormatter(EventQueue &events, const int mapRows, const int mapCols, const int fogTeam)
+{
+    PipelineEvent event;
+    while (true)
+    {
+        events.pop(event);
+        if (event.command.robotLetter == CHAR_END_INPUT)
+            break;
+        displayActionResult(event.command, event.result, event.map, mapRows, mapCols, event.healthPoints,
+                            fogTeam != TEAM_NONE ? event.visibleRobots : NULL);
+    }
+}
+
+void runPipelinedGame(Game &game, const int fogTeam)
+{
+    // The queues are too large for the stack
+    CommandQueue *commands = new CommandQueue;
+    EventQueue *events = new EventQueue;
+
+    // cin flushes cout before every read by default, which would touch cout from the reader
+    // thread while the formatter writes to it
+    ostream *tiedStream = cin.tie(NULL);
+
+    thread reader(runPipelineReader, ref(*commands));
+    thread formatter(runPipelineFormatter, ref(*events), game.getMapRows(), game.getMapCols(), fogTeam);
+    runPipelineSimulation(game, *commands, *events, fogTeam);
+    reader.join();
+    formatter.join();
+    cin.tie(tiedStream);
+
+    delete commands;
+    delete events;
+}
@@ -0,0 +1,16 @@
+#ifndef SHOOTING_GAME_PIPELINE_H
+#define SHOOTING_GAME_PIPELINE_H
+
+#include "shootingGame.h"
+
+// Pipelined mode: for the --pipelined option
+// Reading and parsing the commands, resolving them and formatting the output run on three
+// threads connected by bounded SPSC ring buffers, so the throughput is set by the slowest stage.
+const unsigned int PIPELINE_COMMAND_QUEUE_CAPACITY = 1024;
+const unsigned int PIPELINE_EVENT_QUEUE_CAPACITY = 256;
+
+// Resolve the commands on the standard input with the given game and print the outcomes,
+// exactly as the serial loop in main does; with a fog team, the output only shows what it can see
+void runPipelinedGame(Game &game, const int fogTeam = TEAM_NONE);
+
+#endif
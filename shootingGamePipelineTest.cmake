@@ -0,0 +1,22 @@
+# Runs the game on INPUT serially and with --pipelined, both with the extra OPTIONS, and fails
+# if the two print anything different
+# Usage: cmake -DGAME=<shootingGame> -DINPUT=<commands> [-DOPTIONS="<options>"] -P shootingGamePipelineTest.cmake
+separate_arguments(optionList UNIX_COMMAND "${OPTIONS}")
+
+execute_process(COMMAND ${GAME} ${optionList}
+                INPUT_FILE ${INPUT} OUTPUT_VARIABLE serialOutput RESULT_VARIABLE serialStatus)
+execute_process(COMMAND ${GAME} --pipelined ${optionList}
+                INPUT_FILE ${INPUT} OUTPUT_VARIABLE pipelinedOutput RESULT_VARIABLE pipelinedStatus)
+
+if(NOT serialStatus EQUAL 0 OR NOT pipelinedStatus EQUAL 0)
+    message(FATAL_ERROR "Fail: the game exited with ${serialStatus} serially and ${pipelinedStatus} pipelined")
+endif()
+if(NOT serialOutput MATCHES "=== Game Ended ===")
+    message(FATAL_ERROR "Fail: the serial game did not reach the end of the input")
+endif()
+if(NOT serialOutput STREQUAL pipelinedOutput)
+    file(WRITE ${CMAKE_CURRENT_BINARY_DIR}/serialOutput.txt "${serialOutput}")
+    file(WRITE ${CMAKE_CURRENT_BINARY_DIR}/pipelinedOutput.txt "${pipelinedOutput}")
+    message(FATAL_ERROR "Fail: the pipelined output differs from the serial output, see serialOutput.txt and pipelinedOutput.txt")
+endif()
+message(STATUS "Success: the pipelined output matches the serial output")
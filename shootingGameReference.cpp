@@ -0,0 +1,591 @@
+#include "shootingGameReference.h"
+
+// Do not modify: see shootingGameReference.h
+
+int referenceUpdateHealthPointsForHitAction(int healthPoints[MAX_NUM_ROBOTS],
+                                            char map[MAX_ROWS][MAX_COLS],
+                                            const int mapRows, const int mapCols,
+                                            const char robotLetter,
+                                            const char directionLetter,
+                                            char &targetRobotLetter,
+                                            int &targetOriginalHealthPoint,
+                                            int &targetUpdatedHealthPoint)
+{
+
+    int xloc = 0;
+    int yloc = 0;
+    int stop = 0;
+    for(int i = 0; i < mapRows; i++)
+    {
+        for(int j = 0; j < mapCols; j++)
+        {
+            if(map[i][j] == robotLetter && stop == 0)
+            {
+                xloc = i;
+                yloc = j;
+                stop += 1;
+            }
+        }
+    }
+
+    if(directionLetter == DIRECTION_SOUTH){
+        if(xloc+1 < mapRows)
+        {
+            if(map[xloc+1][yloc] != CHAR_EMPTY)
+            {
+                targetRobotLetter = map[xloc+1][yloc];
+                targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+1][yloc])];
+                targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+1][yloc])] - WEAPON_HIT_DAMAGE;
+                healthPoints[robotLetterToArrayIndex(map[xloc+1][yloc])] -= WEAPON_HIT_DAMAGE;
+                if(targetUpdatedHealthPoint <= 0)
+                {
+                    targetUpdatedHealthPoint = 0;
+                    healthPoints[robotLetterToArrayIndex(map[xloc+1][yloc])] -= WEAPON_HIT_DAMAGE;
+                    map[xloc+1][yloc]='.';
+                }
+
+                return STATUS_ACTION_WEAPON_SUCCESS;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_NORTH){
+        if(xloc-1 >= 0)
+        {
+            if(map[xloc-1][yloc] != CHAR_EMPTY)
+            {
+                targetRobotLetter = map[xloc-1][yloc];
+                targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc-1][yloc])];
+                targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc-1][yloc])] - WEAPON_HIT_DAMAGE;
+                healthPoints[robotLetterToArrayIndex(map[xloc-1][yloc])] -= WEAPON_HIT_DAMAGE;
+                if(targetUpdatedHealthPoint <= 0)
+                {
+                    targetUpdatedHealthPoint = 0;
+                    healthPoints[robotLetterToArrayIndex(map[xloc-1][yloc])] = 0;
+                    map[xloc-1][yloc]='.';
+                }
+                return STATUS_ACTION_WEAPON_SUCCESS;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_EAST){
+        if(yloc+1 < mapCols)
+        {
+            if(map[xloc][yloc+1] != CHAR_EMPTY)
+            {
+                targetRobotLetter = map[xloc][yloc+1];
+                targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+1])];
+                targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+1])] - WEAPON_HIT_DAMAGE;
+                healthPoints[robotLetterToArrayIndex(map[xloc][yloc+1])] -= WEAPON_HIT_DAMAGE;
+                if(targetUpdatedHealthPoint <= 0)
+                {
+                    targetUpdatedHealthPoint = 0;
+                    healthPoints[robotLetterToArrayIndex(map[xloc][yloc+1])] = 0; 
+                    map[xloc][yloc+1]='.'; 
+                }
+                return STATUS_ACTION_WEAPON_SUCCESS;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_WEST){
+        if(yloc-1 <= 0)
+        {
+            if(map[xloc][yloc-1] != CHAR_EMPTY)
+            {
+                targetRobotLetter = map[xloc][yloc-1];
+                targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc-1])];
+                targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc-1])] - WEAPON_HIT_DAMAGE;
+                healthPoints[robotLetterToArrayIndex(map[xloc][yloc-1])] -= WEAPON_HIT_DAMAGE;
+                
+                if(targetUpdatedHealthPoint <= 0)
+                {
+                    targetUpdatedHealthPoint = 0;
+                    healthPoints[robotLetterToArrayIndex(map[xloc][yloc-1])] = 0;
+                    map[xloc][yloc-1]='.';
+                }
+                return STATUS_ACTION_WEAPON_SUCCESS;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else
+    {
+        return STATUS_ACTION_WEAPON_FAIL;
+    }
+
+    return STATUS_ACTION_WEAPON_NOT_IMPLEMENTED;
+}
+
+int referenceUpdateHealthPointsForShootAction(int healthPoints[MAX_NUM_ROBOTS],
+                                              char map[MAX_ROWS][MAX_COLS],
+                                              const int mapRows, const int mapCols,
+                                              const char robotLetter,
+                                              const char directionLetter,
+                                              char &targetRobotLetter,
+                                              int &targetOriginalHealthPoint,
+                                              int &targetUpdatedHealthPoint)
+{
+    int xloc = 0;
+    int yloc = 0;
+    int stop = 0;
+    for(int i = 0; i < mapRows; i++)
+    {
+        for(int j = 0; j < mapCols; j++)
+        {
+            if(map[i][j] == robotLetter && stop == 0)
+            {
+                xloc = i;
+                yloc = j;
+                stop += 1;
+            }
+        }
+    }
+    if(directionLetter == DIRECTION_SOUTH){
+        if(xloc+1 < mapRows)
+        {
+            if(xloc+5 < mapRows)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range <= WEAPON_SHOOT_RANGE; range++)
+                {
+                    if(map[xloc+range][yloc]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        
+                        targetRobotLetter = map[xloc+range][yloc];
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] - WEAPON_SHOOT_DAMAGE;
+                        healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] -= WEAPON_SHOOT_DAMAGE;
+
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] = 0;
+                            map[xloc+range][yloc]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                                
+                    }
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+                
+            }
+            else if(xloc+5 >= mapRows)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range < mapRows-xloc; range++)
+                {
+                    if(map[xloc+range][yloc]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] -= WEAPON_SHOOT_DAMAGE;
+                        targetRobotLetter = map[xloc+range][yloc];
+                        
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc+range][yloc])] = 0;
+                            map[xloc+range][yloc]='.';
+                        }
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                    }
+                    
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_NORTH){
+        if(xloc-1 >= 0)
+        {
+            if(xloc-5 >= 0)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range <= WEAPON_SHOOT_RANGE; range++)
+                {
+                    if(map[xloc-range][yloc]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        
+                        targetRobotLetter = map[xloc-range][yloc];
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc-range][yloc])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc-range][yloc])] - WEAPON_SHOOT_DAMAGE;
+                        healthPoints[robotLetterToArrayIndex(map[xloc-range][yloc])] -= WEAPON_SHOOT_DAMAGE;
+
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc-range][yloc])] = 0;
+                            map[xloc-range][yloc]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                                
+                    }
+                     
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+                
+            }
+            else if(xloc-5 < 0)
+            {
+                int maxshoot = 0;
+                for(int range = xloc-1; range >= 0; range--)
+                {
+                    if(map[range][yloc]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[range][yloc])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[range][yloc])] -= WEAPON_SHOOT_DAMAGE;
+                        targetRobotLetter = map[range][yloc];
+                        
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[range][yloc])] = 0;
+                            map[range][yloc]='.';
+                        }
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                    }
+                    
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+                
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_EAST){
+        if(yloc+1 < mapCols)
+        {
+            if(yloc+5 < mapCols)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range <= WEAPON_SHOOT_RANGE; range++)
+                {
+                    if(map[xloc][yloc+range]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        
+                        targetRobotLetter = map[xloc][yloc+range];
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] - WEAPON_SHOOT_DAMAGE;
+                        healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] -= WEAPON_SHOOT_DAMAGE;
+
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] = 0;
+                            map[xloc][yloc+range]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;           
+                    }
+                    
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+               
+            }
+            else if(yloc+5 >= mapCols)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range < mapCols-yloc; range++)
+                {
+                    if(map[xloc][yloc+range]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] -= WEAPON_SHOOT_DAMAGE;
+                        targetRobotLetter = map[xloc][yloc+range];  
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc][yloc+range])] = 0;
+                            map[xloc][yloc+range]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;   
+                    }
+                    
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else if(directionLetter == DIRECTION_WEST){
+        if(yloc-1 >= 0)
+        {
+            if(yloc-5 >= 0)
+            {
+                int maxshoot = 0;
+                for(int range = 1; range <= WEAPON_SHOOT_RANGE; range++)
+                {
+                    if(map[xloc][yloc-range]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        
+                        targetRobotLetter = map[xloc][yloc-range];
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc-range])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][yloc-range])] - WEAPON_SHOOT_DAMAGE;
+                        healthPoints[robotLetterToArrayIndex(map[xloc][yloc-range])] -= WEAPON_SHOOT_DAMAGE;
+
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc][yloc-range])] = 0;
+                            map[xloc][yloc-range]='.';
+                        }
+                        maxshoot += 1;
+                        return STATUS_ACTION_WEAPON_SUCCESS;     
+                    }
+                
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+            else if(yloc-5 < 0)
+            {
+                int maxshoot = 0;
+                for(int range = yloc-1; range >= 0; range--)
+                {
+                    if(map[xloc][range]!= CHAR_EMPTY && maxshoot == 0)
+                    {
+                        targetOriginalHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][range])];
+                        targetUpdatedHealthPoint = healthPoints[robotLetterToArrayIndex(map[xloc][range])] -= WEAPON_SHOOT_DAMAGE;
+                        targetRobotLetter = map[xloc][range];
+                        
+                        if(targetUpdatedHealthPoint <= 0)
+                        {
+                            targetUpdatedHealthPoint = 0;
+                            healthPoints[robotLetterToArrayIndex(map[xloc][range])] = 0;
+                            map[xloc][range]='.';
+                        }
+                        return STATUS_ACTION_WEAPON_SUCCESS;
+                    }
+                }
+                return STATUS_ACTION_WEAPON_FAIL;
+               
+            }
+            else
+            {
+                return STATUS_ACTION_WEAPON_FAIL;
+            }
+        }
+        else
+        {
+            return STATUS_ACTION_WEAPON_FAIL;
+        }
+    }
+    else
+    {
+        return STATUS_ACTION_WEAPON_FAIL;
+    }
+
+    return STATUS_ACTION_WEAPON_NOT_IMPLEMENTED;
+}
+
+int referenceUpdateMapForMoveAction(char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                                    const char robotLetter, const char directionLetter, const int moveSteps)
+{
+    // remove this line to start your work
+    for(int i = 0; i < mapRows; i++)
+    {
+        for(int j = 0; j < mapCols; j++)
+        {
+            if(map[i][j] == robotLetter)
+            {
+                int xloc = i;
+                int yloc = j;
+                int block = 0;
+                if(directionLetter == DIRECTION_EAST)
+                {
+                    if(yloc+1 < mapCols)
+                    {
+                        int checkblock = 0;
+                        for(int y = yloc+1; y <= moveSteps; y++)
+                        {
+                            if(map[xloc][y] != CHAR_EMPTY)
+                            {
+                                checkblock += 1;
+                            } 
+                        }
+                        if(checkblock == 0)
+                        {
+                            if(yloc+moveSteps < mapCols)
+                            {
+                                map[xloc][yloc]= CHAR_EMPTY;
+                                map[xloc][yloc+moveSteps] = robotLetter;
+                                return STATUS_ACTION_MOVE_SUCCESS;
+                            }
+                            else
+                            {
+                                return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                            }
+                        }
+                        else
+                        {
+                            return STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH;
+                        }
+                    }
+                    else
+                    {
+                        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                    }
+                }
+                else if(directionLetter == DIRECTION_WEST)
+                {
+                    if(yloc-1>= 0)
+                    {
+                        int checkblock = 0;
+                        for(int y = yloc-1; y >= yloc-moveSteps; y--)
+                        {
+                           if(map[xloc][y] != CHAR_EMPTY)
+                            {
+                                checkblock += 1;
+                            } 
+                        }
+                        if(checkblock == 0)
+                        {   if(yloc-moveSteps >= 0)
+                            {
+                                map[xloc][yloc]= CHAR_EMPTY;
+                                map[xloc][yloc-moveSteps] = robotLetter;
+                                return STATUS_ACTION_MOVE_SUCCESS;
+                            }
+                            else
+                            {
+                                return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                            }
+                        }
+                        else
+                        {
+                            return STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH;
+                        }
+                    }
+                    else
+                    {
+                        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                    }
+                }
+                else if(directionLetter == DIRECTION_SOUTH)
+                {
+                    if(xloc+1 < mapRows)
+                    {
+                        int checkblock = 0;
+                        for(int x = xloc+1; x <= moveSteps; x++)
+                        {
+                           if(map[x][yloc] != CHAR_EMPTY)
+                            {
+                                checkblock += 1;
+                            } 
+                        }
+                        if(checkblock == 0)
+                        {
+                            if(xloc+moveSteps < mapRows)
+                            {
+                                map[xloc][yloc]= CHAR_EMPTY;
+                                map[xloc+moveSteps][yloc] = robotLetter;
+                                return STATUS_ACTION_MOVE_SUCCESS;
+                            }
+                            else
+                            {
+                                return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                            }
+                        }
+                        else
+                        {
+                            return STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH;
+                        }
+                    }
+                    else
+                    {
+                        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                    }
+                        
+                }
+                else if(directionLetter == DIRECTION_NORTH)
+                {
+                
+                    if(xloc-1 >= 0)
+                    {
+                        int checkblock = 0;
+                        for(int x = xloc-1; x >= xloc-moveSteps; x--)
+                        {
+                           if(map[x][yloc] != CHAR_EMPTY)
+                            {
+                                checkblock += 1;
+                            } 
+                        }
+                        if(checkblock == 0)
+                        {
+                            if(xloc-moveSteps >= 0)
+                            {
+                                map[xloc][yloc]= CHAR_EMPTY;
+                                map[xloc-moveSteps][yloc] = robotLetter;
+                                return STATUS_ACTION_MOVE_SUCCESS;
+                            }
+                            {
+                                return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                            }
+                        }
+                        else
+                        {
+                            return STATUS_ACTION_MOVE_HIT_ANOTHER_ROBOT_ALONG_PATH;
+                        }
+                    }
+                    else
+                    {
+                        return STATUS_ACTION_MOVE_OUTSIDE_BOUNDARY;
+                    }
+                }
+            }
+        }
+    }
+    return STATUS_ACTION_MOVE_NOT_IMPLMENTED;
+}
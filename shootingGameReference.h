@@ -0,0 +1,29 @@
+#ifndef SHOOTING_GAME_REFERENCE_H
+#define SHOOTING_GAME_REFERENCE_H
+
+#include "shootingGame.h"
+
+// Frozen reference implementation
+// These are the original move, hit and shoot actions, kept unchanged so that shootingGameFuzz can
+// check any change to the engine against them. Do not modify them.
+
+int referenceUpdateHealthPointsForHitAction(int healthPoints[MAX_NUM_ROBOTS],
+                                            char map[MAX_ROWS][MAX_COLS],
+                                            const int mapRows, const int mapCols,
+                                            const char robotLetter,
+                                            const char directionLetter,
+                                            char &targetRobotLetter,
+                                            int &targetOriginalHealthPoint,
+                                            int &targetUpdatedHealthPoint);
+int referenceUpdateHealthPointsForShootAction(int healthPoints[MAX_NUM_ROBOTS],
+                                              char map[MAX_ROWS][MAX_COLS],
+                                              const int mapRows, const int mapCols,
+                                              const char robotLetter,
+                                              const char directionLetter,
+                                              char &targetRobotLetter,
+                                              int &targetOriginalHealthPoint,
+                                              int &targetUpdatedHealthPoint);
+int referenceUpdateMapForMoveAction(char map[MAX_ROWS][MAX_COLS], const int mapRows, const int mapCols,
+                                    const char robotLetter, const char directionLetter, const int moveSteps);
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef SPSC_RING_BUFFER_H
+#define SPSC_RING_BUFFER_H
+
+#include <atomic>
+#include <thread>
+
+// A bounded lock-free queue between exactly one producer thread and one consumer thread.
+// push waits while the buffer is full and pop waits while it is empty, so a fast stage is held
+// back by a slow one instead of buffering without limit. A waiting side yields a few times and
+// then sleeps in std::atomic::wait until the other side moves its index, so an idle pipeline
+// does not burn a core; this needs C++20.
+const int SPSC_SPIN_YIELDS = 64;
+
+template <typename T, unsigned int Capacity>
+class SpscRingBuffer
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscRingBuffer() : head(0), tail(0), cachedTail(0), cachedHead(0) {}
+
+    // Producer side
+    void push(const T &item)
+    {
+        const unsigned int t = tail.load(std::memory_order_relaxed);
+        int spins = 0;
+        while (t - cachedHead == Capacity)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead != Capacity)
+                break;
+            if (spins++ < SPSC_SPIN_YIELDS)
+                std::this_thread::yield();
+            else
+                head.wait(cachedHead, std::memory_order_acquire);
+        }
+        slots[t & (Capacity - 1)] = item;
+        tail.store(t + 1, std::memory_order_release);
+        tail.notify_one();
+    }
+
+    // Consumer side
+    void pop(T &item)
+    {
+        const unsigned int h = head.load(std::memory_order_relaxed);
+        int spins = 0;
+        while (h == cachedTail)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h != cachedTail)
+                break;
+            if (spins++ < SPSC_SPIN_YIELDS)
+                std::this_thread::yield();
+            else
+                tail.wait(cachedTail, std::memory_order_acquire);
+        }
+        item = slots[h & (Capacity - 1)];
+        head.store(h + 1, std::memory_order_release);
+        head.notify_one();
+    }
+
+private:
+    // The indices only ever grow (wrapping around) and each is written by one side only.
+    // Every field sits on its own cache line; each side keeps a private copy of the other
+    // side's index and only reloads it when the buffer looks full or empty.
+    alignas(64) std::atomic<unsigned int> head; // written by the consumer
+    alignas(64) std::atomic<unsigned int> tail; // written by the producer
+    alignas(64) unsigned int cachedTail;        // consumer's last view of tail
+    alignas(64) unsigned int cachedHead;        // producer's last view of head
+    alignas(64) T slots[Capacity];
+};
+
+#endif